@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace BitScan {
+	// Returns the index of the lowest set bit of mask, which must not be zero.
+	inline unsigned Lowest(uint32_t mask) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return index;
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+	inline unsigned Lowest64(uint64_t mask) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return index;
+#elif defined(_MSC_VER)
+		uint32_t low = static_cast<uint32_t>(mask);
+		return low ? Lowest(low) : 32 + Lowest(static_cast<uint32_t>(mask >> 32));
+#else
+		return __builtin_ctzll(mask);
+#endif
+	}
+}
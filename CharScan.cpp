@@ -0,0 +1,110 @@
+#include "PortableCommon.h"
+#include "CharScan.h"
+#include "BitScan.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CHARSCAN_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define CHARSCAN_X86 0
+#endif
+
+#if defined(__GNUC__)
+#define CHARSCAN_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CHARSCAN_TARGET(isa)
+#endif
+
+size_t CharScan::FindEscapeScalar(const wchar_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] == L'\\' || p[i] == 0) return i;
+    }
+    return n;
+}
+
+#if CHARSCAN_X86
+
+static bool HasAvx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    const int osxsave = 1 << 27, avx = 1 << 28;
+    if ((info[2] & (osxsave | avx)) != (osxsave | avx)) return false;
+    if ((_xgetbv(0) & 6) != 6) return false; // OS saves XMM and YMM state
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// The movemask yields sizeof(wchar_t) bits per code unit, hence the division.
+
+CHARSCAN_TARGET("sse2")
+static size_t FindEscapeSse2(const wchar_t* p, size_t n) {
+    constexpr size_t lanes = 16 / sizeof(wchar_t);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    if constexpr (sizeof(wchar_t) == 2) {
+        const __m128i backslash = _mm_set1_epi16(L'\\');
+        for (; i + lanes <= n; i += lanes) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i hit = _mm_or_si128(_mm_cmpeq_epi16(v, backslash), _mm_cmpeq_epi16(v, zero));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+            if (mask) return i + BitScan::Lowest(mask) / sizeof(wchar_t);
+        }
+    } else {
+        const __m128i backslash = _mm_set1_epi32(L'\\');
+        for (; i + lanes <= n; i += lanes) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i hit = _mm_or_si128(_mm_cmpeq_epi32(v, backslash), _mm_cmpeq_epi32(v, zero));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+            if (mask) return i + BitScan::Lowest(mask) / sizeof(wchar_t);
+        }
+    }
+    return i + CharScan::FindEscapeScalar(p + i, n - i);
+}
+
+CHARSCAN_TARGET("avx2")
+static size_t FindEscapeAvx2(const wchar_t* p, size_t n) {
+    constexpr size_t lanes = 32 / sizeof(wchar_t);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    if constexpr (sizeof(wchar_t) == 2) {
+        const __m256i backslash = _mm256_set1_epi16(L'\\');
+        for (; i + lanes <= n; i += lanes) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi16(v, backslash), _mm256_cmpeq_epi16(v, zero));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+            if (mask) return i + BitScan::Lowest(mask) / sizeof(wchar_t);
+        }
+    } else {
+        const __m256i backslash = _mm256_set1_epi32(L'\\');
+        for (; i + lanes <= n; i += lanes) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi32(v, backslash), _mm256_cmpeq_epi32(v, zero));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+            if (mask) return i + BitScan::Lowest(mask) / sizeof(wchar_t);
+        }
+    }
+    return i + FindEscapeSse2(p + i, n - i);
+}
+
+size_t CharScan::FindEscape(const wchar_t* p, size_t n) {
+    using FindEscapeFn = size_t(*)(const wchar_t*, size_t);
+    static const FindEscapeFn fn = HasAvx2() ? FindEscapeAvx2 : FindEscapeSse2;
+    return fn(p, n);
+}
+
+#else
+
+size_t CharScan::FindEscape(const wchar_t* p, size_t n) {
+    return FindEscapeScalar(p, n);
+}
+
+#endif
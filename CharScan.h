@@ -0,0 +1,10 @@
+#pragma once
+
+namespace CharScan {
+	// Returns the offset of the first backslash or NUL in [p, p + n), or n if there is none.
+	// Uses AVX2 or SSE2 when available.
+	size_t FindEscape(const wchar_t* p, size_t n);
+
+	// Portable reference implementation of FindEscape.
+	size_t FindEscapeScalar(const wchar_t* p, size_t n);
+}
@@ -34,27 +34,9 @@
 ////////////////////////////////////////
 // Common headers:
 
-// C headers:
-#include <stdlib.h>
+// C and C++ headers, shared with the modules that build without Windows:
+#include "PortableCommon.h"
 #include <malloc.h>
-#include <memory.h>
-#include <math.h>
-
-// C++ headers:
-#include <algorithm>
-#include <functional>
-#include <numeric>
-#include <string>
-#include <string_view>
-#include <sstream>
-#include <memory>
-#include <vector>
-#include <stack>
-#include <utility>
-#include <limits>
-#include <system_error>
-#include <map>
-#include <set>
 
 // Windows headers:
 
@@ -73,6 +55,7 @@
 #include <wil/com.h>
 #include <wil/result.h>
 #include <wil/result_macros.h>
+#include <wil/resource.h>
 
 ////////////////////////////////////////
 // Common macro definitions:
@@ -0,0 +1,238 @@
+#include "PortableCommon.h"
+#include "DocCache.h"
+
+using DocCache::CacheHeader;
+
+static_assert(std::is_trivially_copyable<RunStyle>::value && std::is_trivially_copyable<RunIndex::Node>::value
+    && std::is_trivially_copyable<RunStyleEntry>::value && std::is_trivially_copyable<ParseCheckpoint>::value,
+    "cache sections are copied as bytes");
+static_assert(sizeof(RunIndex::Node) == 3 * sizeof(uint32_t), "the run index nodes are not part of LAYOUT");
+
+static const char MAGIC[8] = { 'D', 'X', 'F', 'P', 'D', 'O', 'C', 0 };
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const uint32_t LAYOUT = uint32_t(sizeof(wchar_t)) | uint32_t(sizeof(RunStyle)) << 8
+    | uint32_t(sizeof(RunStyleEntry)) << 16 | uint32_t(sizeof(ParseCheckpoint)) << 24;
+
+// xxHash64: four independent lanes over 32-byte blocks, which keeps hashing a large input well
+// below the cost of parsing it, then the tail in steps of 8, 4 and 1 bytes.
+static const uint64_t PRIME1 = 0x9E3779B185EBCA87ull, PRIME2 = 0xC2B2AE3D27D4EB4Full,
+    PRIME3 = 0x165667B19E3779F9ull, PRIME4 = 0x85EBCA77C2B2AE63ull, PRIME5 = 0x27D4EB2F165667C5ull;
+
+static inline uint64_t Rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+static inline uint64_t Round(uint64_t lane, uint64_t word) { return Rotl(lane + word * PRIME2, 31) * PRIME1; }
+static inline uint64_t Merge(uint64_t h, uint64_t lane) { return (h ^ Round(0, lane)) * PRIME1 + PRIME4; }
+static inline uint64_t Read64(const uint8_t* p) {
+    uint64_t w;
+    memcpy(&w, p, sizeof w);
+    return w;
+}
+static inline uint32_t Read32(const uint8_t* p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof w);
+    return w;
+}
+
+uint64_t DocCache::Hash(const void* data, size_t n, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    size_t i = 0;
+    uint64_t h;
+    if (n >= 32) {
+        uint64_t v1 = seed + PRIME1 + PRIME2, v2 = seed + PRIME2, v3 = seed, v4 = seed - PRIME1;
+        for (; i + 32 <= n; i += 32) {
+            v1 = Round(v1, Read64(p + i));
+            v2 = Round(v2, Read64(p + i + 8));
+            v3 = Round(v3, Read64(p + i + 16));
+            v4 = Round(v4, Read64(p + i + 24));
+        }
+        h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+        h = Merge(Merge(Merge(Merge(h, v1), v2), v3), v4);
+    } else {
+        h = seed + PRIME5;
+    }
+    h += n;
+    for (; i + 8 <= n; i += 8) h = Rotl(h ^ Round(0, Read64(p + i)), 27) * PRIME1 + PRIME4;
+    if (i + 4 <= n) {
+        h = Rotl(h ^ (Read32(p + i) * PRIME1), 23) * PRIME2 + PRIME3;
+        i += 4;
+    }
+    for (; i < n; i++) h = Rotl(h ^ (p[i] * PRIME5), 11) * PRIME1;
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    return h ^ (h >> 32);
+}
+
+static uint64_t HashString(const std::wstring& s, uint64_t seed) {
+    return DocCache::Hash(s.data(), s.size() * sizeof(wchar_t), seed);
+}
+
+uint64_t DocCache::KeyOf(const std::wstring_view& input, const FontSelector& fs) {
+    uint64_t h = DocCache::Hash(input.data(), input.size() * sizeof(wchar_t), DOC_PARSER_VERSION);
+    h = HashString(fs.userFeatureSettings, h);
+    h = HashString(fs.userVariationSettings, h);
+    return h ^ (fs.parseEscapes ? PRIME4 : 0);
+}
+
+static uint64_t Align(uint64_t offset) { return (offset + 7) & ~uint64_t(7); }
+
+// Empty sections come from empty vectors, whose data() may be null, which memcpy must not get.
+static void CopySection(uint8_t* out, const void* data, size_t bytes) {
+    if (bytes != 0) memcpy(out, data, bytes);
+}
+
+std::vector<uint8_t> DocCache::Write(const ParsedDocument& doc, uint64_t key) {
+    std::vector<uint32_t> styleOffsets(doc.styleTable.Size() + 1);
+    for (StyleId id = 0; id < doc.styleTable.Size(); id++) {
+        styleOffsets[id + 1] = styleOffsets[id] + static_cast<uint32_t>(doc.styleTable.Get(id).size());
+    }
+
+    CacheHeader header = {};
+    memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.formatVersion = FORMAT_VERSION;
+    header.parserVersion = DOC_PARSER_VERSION;
+    header.layout = LAYOUT;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.key = key;
+    header.textLength = static_cast<uint32_t>(doc.text.size());
+    header.runCount = static_cast<uint32_t>(doc.styles.size());
+    header.styleCount = static_cast<uint32_t>(doc.styleTable.Size());
+    header.entryCount = styleOffsets.back();
+    header.checkpointCount = static_cast<uint32_t>(doc.checkpoints.size());
+    header.coalescedRuns = doc.coalescedRuns;
+    header.unknownTags = doc.unknownTags;
+    header.textOffset = Align(sizeof(CacheHeader));
+    header.runOffset = Align(header.textOffset + uint64_t(header.textLength) * sizeof(wchar_t));
+    header.indexOffset = Align(header.runOffset + uint64_t(header.runCount) * sizeof(RunStyle));
+    header.styleOffset = Align(header.indexOffset + (uint64_t(header.runCount) + 1) * sizeof(RunIndex::Node));
+    header.entryOffset = Align(header.styleOffset + styleOffsets.size() * sizeof(uint32_t));
+    header.checkpointOffset = Align(header.entryOffset + uint64_t(header.entryCount) * sizeof(RunStyleEntry));
+    header.size = header.checkpointOffset + uint64_t(header.checkpointCount) * sizeof(ParseCheckpoint);
+
+    std::vector<uint8_t> image(static_cast<size_t>(header.size)); // zeroes the padding
+    uint8_t* out = image.data();
+    memcpy(out, &header, sizeof header);
+    CopySection(out + header.textOffset, doc.text.data(), doc.text.size() * sizeof(wchar_t));
+    CopySection(out + header.runOffset, doc.styles.data(), doc.styles.size() * sizeof(RunStyle));
+    // A document without runs may have an index without a tree, which stays a zeroed node.
+    const ImageVector<RunIndex::Node>& nodes = doc.runIndex.Nodes();
+    CopySection(out + header.indexOffset, nodes.data(), nodes.size() * sizeof(RunIndex::Node));
+    CopySection(out + header.styleOffset, styleOffsets.data(), styleOffsets.size() * sizeof(uint32_t));
+    for (StyleId id = 0; id < doc.styleTable.Size(); id++) {
+        StyleSpan entries = doc.styleTable.Get(id);
+        CopySection(out + header.entryOffset + styleOffsets[id] * sizeof(RunStyleEntry), entries.data(), entries.size() * sizeof(RunStyleEntry));
+    }
+    CopySection(out + header.checkpointOffset, doc.checkpoints.data(), doc.checkpoints.size() * sizeof(ParseCheckpoint));
+    return image;
+}
+
+bool CachedDocument::Open(const void* data, size_t size, uint64_t key) {
+    m_data = nullptr;
+    m_header = nullptr;
+    if (size < sizeof(CacheHeader) || reinterpret_cast<uintptr_t>(data) % alignof(CacheHeader) != 0) return false;
+
+    const CacheHeader& h = *static_cast<const CacheHeader*>(data);
+    if (memcmp(h.magic, MAGIC, sizeof MAGIC) != 0 || h.formatVersion != DocCache::FORMAT_VERSION
+        || h.parserVersion != DOC_PARSER_VERSION || h.layout != LAYOUT || h.byteOrder != BYTE_ORDER_MARK || h.key != key) {
+        return false;
+    }
+
+    // Each section must start aligned after the previous one and the last must end at the
+    // end of the image, which also catches a truncated file.
+    struct SectionBounds {
+        uint64_t offset, count, elementSize;
+    };
+    const SectionBounds sections[] = {
+        { h.textOffset, h.textLength, sizeof(wchar_t) },
+        { h.runOffset, h.runCount, sizeof(RunStyle) },
+        { h.indexOffset, uint64_t(h.runCount) + 1, sizeof(RunIndex::Node) },
+        { h.styleOffset, uint64_t(h.styleCount) + 1, sizeof(uint32_t) },
+        { h.entryOffset, h.entryCount, sizeof(RunStyleEntry) },
+        { h.checkpointOffset, h.checkpointCount, sizeof(ParseCheckpoint) },
+    };
+    uint64_t end = sizeof(CacheHeader);
+    for (const auto& s : sections) {
+        if (s.offset != Align(end) || s.offset > size) return false;
+        end = s.offset + s.count * s.elementSize;
+    }
+    if (end != h.size || h.size != size) return false;
+
+    // Style sets are looked up through the offsets, so check them once here.
+    const uint32_t* styleOffsets = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(data) + h.styleOffset);
+    if (styleOffsets[0] != 0 || styleOffsets[h.styleCount] != h.entryCount) return false;
+    for (uint32_t id = 0; id < h.styleCount; id++) {
+        if (styleOffsets[id] > styleOffsets[id + 1]) return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_header = &h;
+    return true;
+}
+
+std::wstring_view CachedDocument::Text() const {
+    return std::wstring_view(Section<wchar_t>(m_header->textOffset), m_header->textLength);
+}
+
+StyleSpan CachedDocument::Style(StyleId id) const {
+    if (id >= m_header->styleCount) return { nullptr, nullptr };
+    const uint32_t* styleOffsets = Section<uint32_t>(m_header->styleOffset);
+    const RunStyleEntry* entries = Section<RunStyleEntry>(m_header->entryOffset);
+    return { entries + styleOffsets[id], entries + styleOffsets[id + 1] };
+}
+
+void CachedDocument::Load(ParsedDocument& doc, std::shared_ptr<const void> image) const {
+    doc.text = Text();
+    doc.storage = std::move(image);
+    doc.styles = ImageVector<RunStyle>::Borrow(Runs(), RunCount());
+    doc.runIndex = RunIndex::Borrow(Section<RunIndex::Node>(m_header->indexOffset), RunCount() + 1);
+    doc.styleTable = StyleTable::Borrow(Section<uint32_t>(m_header->styleOffset), StyleCount(), Section<RunStyleEntry>(m_header->entryOffset));
+    doc.checkpoints = ImageVector<ParseCheckpoint>::Borrow(Section<ParseCheckpoint>(m_header->checkpointOffset), m_header->checkpointCount);
+    doc.coalescedRuns = m_header->coalescedRuns;
+    doc.unknownTags = m_header->unknownTags;
+}
+
+bool CachedDocument::Verify() const {
+    const RunStyle* runs = Runs();
+    uint32_t cp = 0;
+    for (size_t j = 0; j < RunCount(); j++) {
+        if (runs[j].cpBegin < cp || runs[j].cpEnd < runs[j].cpBegin || runs[j].cpEnd > m_header->textLength
+            || runs[j].style >= m_header->styleCount) {
+            return false;
+        }
+        cp = runs[j].cpEnd;
+    }
+
+    // An in-order walk of the tree must visit every run in order: from the leftmost node, the
+    // next is the leftmost of the right subtree, or else the first ancestor entered from the left.
+    const RunIndex::Node* tree = Section<RunIndex::Node>(m_header->indexOffset);
+    size_t k = 1;
+    while (2 * k <= RunCount()) k *= 2;
+    for (size_t j = 0; j < RunCount(); j++) {
+        if (tree[k].run != j || tree[k].cpBegin != runs[j].cpBegin || tree[k].cpEnd != runs[j].cpEnd) return false;
+        if (2 * k + 1 <= RunCount()) {
+            k = 2 * k + 1;
+            while (2 * k <= RunCount()) k *= 2;
+        } else {
+            while (k & 1) k >>= 1;
+            k >>= 1;
+        }
+    }
+
+    const ParseCheckpoint* checkpoints = Section<ParseCheckpoint>(m_header->checkpointOffset);
+    for (size_t j = 0; j < m_header->checkpointCount; j++) {
+        // Incremental parsing restores runs and styles from the checkpoints, and looks them up
+        // by source position.
+        const ParseCheckpoint& c = checkpoints[j];
+        if (c.runCount > RunCount() || c.cpCurrent > m_header->textLength || c.cpRunBegin > c.cpCurrent
+            || c.style >= m_header->styleCount) {
+            return false;
+        }
+        if (j > 0 && (c.srcPos < checkpoints[j - 1].srcPos || c.runCount < checkpoints[j - 1].runCount)) return false;
+        // A last run that the current one may continue must exist and start before it.
+        if (c.lastRunStyle != NO_STYLE_ID && (c.runCount == 0 || c.lastRunStyle >= m_header->styleCount
+            || runs[c.runCount - 1].cpBegin > c.cpRunBegin)) {
+            return false;
+        }
+    }
+    return true;
+}
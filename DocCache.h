@@ -0,0 +1,89 @@
+#pragma once
+#include "DocParser.h"
+
+// A binary image of a ParsedDocument, e.g. in a mapped file. All sections are 8-byte aligned
+// arrays of the in-memory types, so a document loaded from it uses them in place:
+//
+//   CacheHeader
+//   wchar_t       text[textLength]
+//   RunStyle      runs[runCount]
+//   RunIndex::Node index[runCount + 1]         // the Eytzinger tree of the run index
+//   uint32_t      styleOffsets[styleCount + 1] // style set i is entries[styleOffsets[i], styleOffsets[i + 1])
+//   RunStyleEntry entries[entryCount]
+//   ParseCheckpoint checkpoints[checkpointCount]
+//
+// An image is only valid for the build that wrote it: it is tied to the parser version, the
+// content key of its input and the sizes of the types above.
+namespace DocCache {
+	constexpr uint32_t FORMAT_VERSION = 3;
+
+	struct CacheHeader {
+		char     magic[8];
+		uint32_t formatVersion;
+		uint32_t parserVersion;
+		uint32_t layout;           // sizes of the section types, which differ between platforms
+		uint32_t byteOrder;
+		uint64_t key;              // KeyOf the parsed input
+		uint64_t size;             // of the whole image
+		uint32_t textLength;
+		uint32_t runCount;
+		uint32_t styleCount;
+		uint32_t entryCount;
+		uint32_t checkpointCount;
+		uint32_t coalescedRuns;
+		uint32_t unknownTags;
+		uint32_t reserved;
+		uint64_t textOffset;
+		uint64_t runOffset;
+		uint64_t indexOffset;
+		uint64_t styleOffset;
+		uint64_t entryOffset;
+		uint64_t checkpointOffset;
+	};
+
+	// XXH64 of n bytes, chained through seed. The value is the same on every platform and
+	// build with the same byte order.
+	uint64_t Hash(const void* data, size_t n, uint64_t seed);
+
+	// Hash of everything the parse depends on: the input, the settings that affect parsing and
+	// the parser version.
+	uint64_t KeyOf(const std::wstring_view& input, const FontSelector& fs);
+
+	// Serializes doc, which was parsed from an input whose KeyOf is key.
+	std::vector<uint8_t> Write(const ParsedDocument& doc, uint64_t key);
+}
+
+// A view of a document cache image. It only refers to the image, which must outlive it.
+class CachedDocument {
+public:
+	CachedDocument() = default;
+
+	// Checks the header and section bounds of the image. Returns false, leaving the view
+	// closed, unless data is a complete image for key written by this build.
+	bool Open(const void* data, size_t size, uint64_t key);
+	bool IsOpen() const { return m_header != nullptr; }
+
+	std::wstring_view Text() const;
+	const RunStyle* Runs() const { return Section<RunStyle>(m_header->runOffset); }
+	size_t RunCount() const { return m_header->runCount; }
+	size_t StyleCount() const { return m_header->styleCount; }
+	// Entries of the style set id, sorted by (type, tag).
+	StyleSpan Style(StyleId id) const;
+	uint32_t UnknownTags() const { return m_header->unknownTags; }
+
+	// Points doc at the sections of the image, which image must own. Nothing is copied or
+	// rebuilt, so loading takes the same time for any size of document; the document copies a
+	// section only once it is edited. The contents of the sections are not checked.
+	void Load(ParsedDocument& doc, std::shared_ptr<const void> image) const;
+	// Checks that the runs, the run index and the checkpoints fit the text, the style table and
+	// each other, which takes time linear in their number. Images written by Write pass; this
+	// is for images that may have been changed since.
+	bool Verify() const;
+
+private:
+	template<typename T>
+	const T* Section(uint64_t offset) const { return reinterpret_cast<const T*>(m_data + offset); }
+
+	const uint8_t* m_data = nullptr;
+	const DocCache::CacheHeader* m_header = nullptr;
+};
@@ -1,23 +1,42 @@
-#include "Common.h"
+#include "PortableCommon.h"
 #include "DocParser.h"
+#include "CharScan.h"
 
+using namespace OpenType::Literals;
+
+// When the input is not final, i.e. more of it may follow in a later chunk, any read at or
+// past its end marks the parser as starved: whatever it decided from that read is not reliable.
 class TextParser {
 public:
     TextParser(const std::wstring_view& input): m_input(input), m_p(0) {}
     TextParser(const std::wstring_view& input, size_t p): m_input(input), m_p(p) {}
-    TextParser(const TextParser& from): m_input(from.m_input), m_p(from.m_p) {}
+    TextParser(const std::wstring_view& input, size_t p, bool final): m_input(input), m_p(p), m_final(final) {}
     wchar_t current() {
-        if (m_p >= m_input.size()) return 0;
+        if (m_p >= m_input.size()) return endOfInput();
         return m_input[m_p];
     }
     wchar_t ahead(size_t delta) {
-        if (m_p + delta >= m_input.size()) return 0;
+        if (m_p + delta >= m_input.size()) return endOfInput();
         return m_input[m_p + delta];
     }
     wchar_t advance() {
-        if (m_p >= m_input.size()) return 0;
+        if (m_p >= m_input.size()) return endOfInput();
         return m_input[m_p++];
     }
+    size_t position() {
+        return m_p;
+    }
+    bool starved() {
+        return m_starved;
+    }
+    // Consumes a run of plain characters, stopping at an escape, a NUL, or the limit.
+    std::wstring_view plainSpan(size_t limit) {
+        size_t begin = m_p;
+        size_t end = std::min(limit, m_input.size());
+        if (begin >= end) return std::wstring_view();
+        m_p += CharScan::FindEscape(m_input.data() + begin, end - begin);
+        return m_input.substr(begin, m_p - begin);
+    }
 
     bool fWord() {
         wchar_t ch = current();
@@ -52,8 +71,15 @@ public:
         return ch == L',' || ch == L';';
     }
 private:
-    const std::wstring_view m_input;
+    wchar_t endOfInput() {
+        if (!m_final) m_starved = true;
+        return 0;
+    }
+
+    std::wstring_view m_input;
     size_t m_p;
+    bool m_final = true;
+    bool m_starved = false;
 };
 
 static void splitSurrogate(const uint32_t in, wchar_t &wchHigh, wchar_t &wchLow) noexcept {
@@ -73,29 +99,22 @@ static inline int from_hex(wchar_t c) {
         return -1;
 }
 
-static void swapByteOrder(uint32_t& ui) {
-    ui = (ui >> 24) |
-        ((ui << 8) & 0x00FF0000) |
-        ((ui >> 8) & 0x0000FF00) |
-        (ui << 24);
-}
+static_assert(OpenType::ClassifyTag("liga"_tag) == OpenType::TagFeature, "liga is a registered feature");
+static_assert(OpenType::ClassifyTag("ital"_tag) == (OpenType::TagFeature | OpenType::TagAxis), "ital is both");
+static_assert(OpenType::ClassifyTag("ss21"_tag) == OpenType::TagUnregistered, "ss21 is not registered");
 
 static bool Tag(TextParser& ps, uint32_t& result) {
     if (!ps.fWord()) return false;
 
+    char chars[4] = { ' ', ' ', ' ', ' ' }; // Pad spaces
     size_t digits = 0;
     while (ps.fWord()) {
-        wchar_t ch = ps.current();
-        result = (result << 8) | (ch & 0xFF);
+        if (digits < 4) chars[digits] = static_cast<char>(ps.current() & 0xFF);
         digits++;
         ps.advance();
     }
     if (digits > 4) return false;
-    while (digits < 4) {
-        result = (result << 8) | 0x20; // Pad spaces
-        digits++;
-    }
-    swapByteOrder(result); // DWrite use little-endian :(
+    result = OpenType::MakeTag(chars[0], chars[1], chars[2], chars[3]);
     return true;
 }
 
@@ -165,8 +184,11 @@ static bool FeatureAssign(TextParser& ps, bool& fMinus, uint32_t& tag, double& p
     return true;
 }
 
-static bool FeatureAssignmentSet(TextParser& ps, RunStyleType styleType, RunStyleState& style) {
-    if (!Expect(ps, L'{')) return false;
+// The assignments between the braces of a style escape, or of a settings string.
+// Counts the tags that are not registered for styleType in unknownTags. They are applied all the
+// same, as a font may define its own features and axes.
+static bool FeatureAssignments(TextParser& ps, RunStyleType styleType, RunStyleState& style, uint32_t& unknownTags) {
+    const uint8_t registeredAs = styleType == RunStyleType::Feature ? OpenType::TagFeature : OpenType::TagAxis;
     SkipSpaces(ps);
     if (ps.current() == L'-' && ps.ahead(1) == L'}') {
         ps.advance();
@@ -174,39 +196,41 @@ static bool FeatureAssignmentSet(TextParser& ps, RunStyleType styleType, RunStyl
     } else {
         bool started = false;
         for (;;) {
+            SkipSpaces(ps);
             if (!ps.current() || ps.current() == L'}') break;
             if (started && !Separator(ps)) return false;
             bool fMinus;
             uint32_t tag;
             double value;
             if (!FeatureAssign(ps, fMinus, tag, value)) return false;
+            unknownTags += (OpenType::ClassifyTag(tag) & registeredAs) == 0;
             if (fMinus) {
                 style.ClearStyles(styleType, tag);
             } else {
-                style.SetStyle(styleType, tag, value);
+                style.SetStyle(styleType, tag, static_cast<float>(value));
             }
             started = true;
         }
     }
     SkipSpaces(ps);
-    if (!Expect(ps, L'}')) return false;
     return true;
 }
 
+static bool FeatureAssignmentSet(TextParser& ps, RunStyleType styleType, RunStyleState& style, uint32_t& unknownTags) {
+    if (!Expect(ps, L'{')) return false;
+    if (!FeatureAssignments(ps, styleType, style, unknownTags)) return false;
+    return Expect(ps, L'}');
+}
+
 
-static bool parseStyle(DocumentBuilder& db, TextParser& parser) {
+static bool parseStyle(TextParser& parser, RunStyleState& rs, uint32_t& unknownTags) {
     wchar_t commandType = parser.advance();
     RunStyleType styleType;
     if (commandType == L'f') styleType = RunStyleType::Feature;
     else if (commandType == L'v') styleType = RunStyleType::Variation;
     else return false;
 
-    RunStyleState rs = db.GetCurrentStyle();
-
-    if (!FeatureAssignmentSet(parser, styleType, rs)) return false;
-    db.Update(rs);
-
-    return true;
+    return FeatureAssignmentSet(parser, styleType, rs, unknownTags);
 }
 
 int parseEscapeChar(TextParser& parser) {
@@ -260,80 +284,499 @@ int parseEscapeChar(TextParser& parser) {
     return c;
 }
 
-void ParseInput(DocumentBuilder& db, TextParser& parser) {
+constexpr uint32_t CHECKPOINT_INTERVAL = 4096;
+
+// Records top-level checkpoints while parsing. When given a previous parse, it also
+// watches for a boundary where the new parse has converged with the old one, after
+// which the rest of the old document can be reused.
+class CheckpointTracker {
+public:
+    CheckpointTracker() : m_out(nullptr), m_next(SIZE_MAX) {}
+    CheckpointTracker(std::vector<ParseCheckpoint>& out) : m_out(&out) {}
+    CheckpointTracker(std::vector<ParseCheckpoint>& out, size_t lastRecorded)
+        : m_out(&out), m_lastRecorded(lastRecorded), m_next(lastRecorded + CHECKPOINT_INTERVAL) {}
+
+    void ResyncWith(const ParsedDocument& previous, size_t firstCandidate, ptrdiff_t srcDelta) {
+        m_previous = &previous;
+        m_candidate = firstCandidate;
+        m_srcDelta = srcDelta;
+        m_next = std::min(m_next, CandidatePosition());
+    }
+
+    size_t NextBoundary() {
+        return m_next;
+    }
+    size_t ResyncIndex() {
+        return m_candidate;
+    }
+
+    // Returns true if the parse can stop here and take the rest from the previous document.
+    bool AtBoundary(DocumentBuilder& db, size_t srcPos) {
+        if (!db.IsTopLevel()) {
+            // Only an escape can close the scope, so plain text needs no further checks.
+            m_next = SIZE_MAX;
+            m_inScope = true;
+            return false;
+        }
+        while (CandidatePosition() < srcPos) m_candidate++;
+        if (CandidatePosition() == srcPos && db.Matches(m_previous->checkpoints[m_candidate])) return true;
+
+        if (m_out->empty() || srcPos >= m_lastRecorded + CHECKPOINT_INTERVAL) {
+            m_out->push_back(db.Checkpoint(static_cast<uint32_t>(srcPos)));
+            m_lastRecorded = srcPos;
+        }
+        m_next = std::max(srcPos + 1, std::min(m_lastRecorded + CHECKPOINT_INTERVAL, CandidatePosition()));
+        return false;
+    }
+
+    void AfterEscape(size_t srcPos) {
+        if (m_inScope) {
+            m_inScope = false;
+            m_next = srcPos;
+        }
+    }
+
+private:
+    size_t CandidatePosition() {
+        if (!m_previous || m_candidate >= m_previous->checkpoints.size()) return SIZE_MAX;
+        return static_cast<size_t>(m_previous->checkpoints[m_candidate].srcPos + m_srcDelta);
+    }
+
+    std::vector<ParseCheckpoint>* m_out;
+    size_t m_lastRecorded = 0;
+    size_t m_next = 0;
+    bool m_inScope = false; // below the top level, waiting for an escape to check again
+
+    const ParsedDocument* m_previous = nullptr;
+    size_t m_candidate = 0;
+    ptrdiff_t m_srcDelta = 0;
+};
+
+// What an escape sequence does to the document. It is worked out before anything is
+// applied, so that an escape cut off at the end of a chunk can be retried later.
+struct EscapeAction {
+    enum Kind { None, Text, BeginSubrun, EndSubrun, Style };
+    Kind          kind = None;
+    wchar_t       text[2] = {};
+    size_t        textLength = 0;
+    RunStyleState style;
+    uint32_t      unknownTags = 0;
+
+    void SetText(wchar_t wch) {
+        kind = Text;
+        text[0] = wch;
+        textLength = 1;
+    }
+};
+
+// Parses the escape sequence following a backslash.
+static EscapeAction ParseEscape(DocumentBuilder& db, TextParser& parser) {
+    EscapeAction action;
+    wchar_t c = parser.current();
+    switch (c) {
+    case L'\0':
+        break;
+    case L'\\':
+        action.SetText(c);
+        parser.advance();
+        break;
+    case L'\r':
+        if (parser.ahead(1) == L'\n') parser.advance();
+        // fall through
+    case L'\n':
+        parser.advance();
+        break;
+    case L'{':
+        action.kind = EscapeAction::BeginSubrun;
+        parser.advance();
+        break;
+    case L'}':
+        action.kind = EscapeAction::EndSubrun;
+        parser.advance();
+        break;
+    case L'f':
+    case L'v':
+        action.style = db.GetCurrentStyle();
+        if (parseStyle(parser, action.style, action.unknownTags)) {
+            action.kind = EscapeAction::Style;
+        } else {
+            action.SetText(L'\xFFFD');
+        }
+        break;
+    default:
+        int lch = parseEscapeChar(parser);
+        if (lch < 0) {
+            action.SetText(L'\xFFFD');
+        } else if (lch < 0x10000) {
+            action.SetText(static_cast<wchar_t>(lch));
+        } else {
+            action.kind = EscapeAction::Text;
+            splitSurrogate(lch, action.text[0], action.text[1]);
+            action.textLength = 2;
+        }
+        break;
+    }
+    return action;
+}
+
+static void ApplyEscape(DocumentBuilder& db, const EscapeAction& action) {
+    switch (action.kind) {
+    case EscapeAction::Text:
+        db.Add(std::wstring_view(action.text, action.textLength));
+        break;
+    case EscapeAction::BeginSubrun:
+        db.BeginSubrun();
+        break;
+    case EscapeAction::EndSubrun:
+        db.EndSubrun();
+        break;
+    case EscapeAction::Style:
+        db.Update(action.style);
+        db.CountUnknownTags(action.unknownTags);
+        break;
+    default:
+        break;
+    }
+}
+
+enum class ParseStop {
+    End,       // end of the input, or a NUL
+    Resynced,  // converged with the previous parse given to the tracker
+    NeedInput  // the next token may continue past the end of a non-final input
+};
+
+static ParseStop ParseInput(DocumentBuilder& db, TextParser& parser, CheckpointTracker& tracker) {
     for (;;) {
-        wchar_t c = parser.advance();
-        if (!c) break;
+        size_t p = parser.position();
+        if (p >= tracker.NextBoundary() && tracker.AtBoundary(db, p)) return ParseStop::Resynced;
+        std::wstring_view plain = parser.plainSpan(tracker.NextBoundary());
+        if (!plain.empty()) {
+            db.Add(plain);
+            continue;
+        }
+        TextParser token(parser);
+        wchar_t c = token.advance();
+        if (token.starved()) return ParseStop::NeedInput;
+        if (!c) return ParseStop::End;
         if (c == L'\\') {
-            c = parser.current();
-            switch (c) {
-            case L'\0':
-                break;
-            case L'\\':
-                db.Add(c);
-                parser.advance();
-                break;
-            case L'\r':
-                if (parser.ahead(1) == L'\n') parser.advance();
-                // fall through
-            case L'\n':
-                parser.advance();
-                continue;
-            case L'{':
-                db.BeginSubrun();
-                parser.advance();
-                break;
-            case L'}':
-                db.EndSubrun();
-                parser.advance();
-                break;
-            case L'f':
-            case L'v':
-                if (!parseStyle(db, parser)) {
-                    db.Add(L'\xFFFD');
-                }
-                break;
-            default:
-                int lch = parseEscapeChar(parser);
-                if (lch < 0) {
-                    db.Add(L'\xFFFD');
-                } else if (lch < 0x10000) {
-                    db.Add(static_cast<wchar_t>(lch));
-                } else {
-                    wchar_t high, low;
-                    splitSurrogate(lch, high, low);
-                    db.Add(high);
-                    db.Add(low);
-                }
-                break;
-            }
+            EscapeAction action = ParseEscape(db, token);
+            if (token.starved()) return ParseStop::NeedInput;
+            ApplyEscape(db, action);
+            tracker.AfterEscape(token.position());
         } else {
             db.Add(c);
         }
+        parser = token;
+    }
+}
+
+bool CompiledStyleSettings::Matches(const FontSelector& fs) const {
+    return featureSettings == fs.userFeatureSettings && variationSettings == fs.userVariationSettings;
+}
+
+// Settings with a syntax error are ignored as a whole.
+static StyleSettingsError CompileSettings(const std::wstring& settings, RunStyleType styleType, CompiledStyleSettings& compiled) {
+    TextParser parser(settings);
+    RunStyleState rs = compiled.root;
+    uint32_t unknownTags = 0;
+    if (!FeatureAssignments(parser, styleType, rs, unknownTags) || parser.position() < settings.size()) {
+        return StyleSettingsError{ true, static_cast<uint32_t>(std::min(parser.position(), settings.size())) };
     }
+    compiled.root = std::move(rs);
+    compiled.unknownTags += unknownTags;
+    return StyleSettingsError{};
+}
+
+std::shared_ptr<const CompiledStyleSettings> CompileStyleSettings(const FontSelector& fs) {
+    auto compiled = std::make_shared<CompiledStyleSettings>();
+    compiled->featureSettings = fs.userFeatureSettings;
+    compiled->variationSettings = fs.userVariationSettings;
+    compiled->root.cpBegin = 0;
+    compiled->featureError = CompileSettings(fs.userFeatureSettings, RunStyleType::Feature, *compiled);
+    compiled->variationError = CompileSettings(fs.userVariationSettings, RunStyleType::Variation, *compiled);
+    return compiled;
 }
 
-ParsedDocument ParseInputDoc(const std::wstring_view& input, const FontSelector& fs) {
-    DocumentBuilder db;
+// The selector's compiled settings, or freshly compiled ones if it has none for its current settings.
+static std::shared_ptr<const CompiledStyleSettings> SettingsOf(const FontSelector& fs) {
+    if (fs.compiledSettings && fs.compiledSettings->Matches(fs)) return fs.compiledSettings;
+    return CompileStyleSettings(fs);
+}
+
+static void BeginDocument(DocumentBuilder& db, const CompiledStyleSettings& settings) {
     db.BeginSubrun();
-    parseStyle(db, TextParser(L"f{" + fs.userFeatureSettings + L"}"));
-    parseStyle(db, TextParser(L"v{" + fs.userVariationSettings + L"}"));
-    if (fs.parseEscapes) ParseInput(db, TextParser(input));
-    else for (const auto& wch : input) db.Add(wch);
-    db.EndSubrun();
-    return { db.GetText(), db.GetStyles() };
+    db.Update(settings.root);
+    db.CountUnknownTags(settings.unknownTags);
+}
+
+static void BeginDocument(DocumentBuilder& db, const FontSelector& fs) {
+    BeginDocument(db, *SettingsOf(fs));
+}
+
+static ParsedDocument ParseInputDoc(DocumentBuilder& db, const std::wstring_view& input, const FontSelector& fs, ParseOptions options) {
+    ParsedDocument doc;
+    if (options & ParseSegmentation) db.EnableSegmentation();
+    BeginDocument(db, fs);
+    if (fs.parseEscapes) {
+        TextParser parser(input);
+        CheckpointTracker tracker(doc.checkpoints.edit());
+        ParseInput(db, parser, tracker);
+    } else {
+        db.Add(input);
+    }
+    db.EndDocument();
+    db.Finish(doc);
+    doc.runIndex = RunIndex(doc.styles);
+    return doc;
+}
+
+ParsedDocument ParseInputDoc(const std::wstring_view& input, const FontSelector& fs, ParseOptions options) {
+    DocumentBuilder db(input.size());
+    return ParseInputDoc(db, input, fs, options);
+}
+
+ParsedDocument ParseInputDoc(SharedText input, const FontSelector& fs, ParseOptions options) {
+    // The builder lets go of the source once the text departs from it, while the parser
+    // still reads the input, so input keeps it alive.
+    DocumentBuilder db(input);
+    return ParseInputDoc(db, *input, fs, options);
+}
+
+DocumentStreamParser::DocumentStreamParser(const FontSelector& fs, DocumentSink sink)
+    : m_sink(std::move(sink)), m_parseEscapes(fs.parseEscapes) {
+    BeginDocument(m_builder, fs);
+}
+
+void DocumentStreamParser::Feed(const std::wstring_view& chunk) {
+    if (m_stopped || m_finished) return;
+    if (!m_parseEscapes) {
+        m_builder.Add(chunk);
+    } else {
+        m_pending.append(chunk);
+        Parse(false);
+    }
+    m_builder.Drain(m_sink, false);
+}
+
+void DocumentStreamParser::Finish() {
+    if (m_finished) return;
+    if (!m_stopped && m_parseEscapes) Parse(true);
+    m_builder.EndDocument();
+    m_builder.Drain(m_sink, true);
+    m_finished = true;
+}
+
+void DocumentStreamParser::Parse(bool final) {
+    TextParser parser(m_pending, 0, final);
+    CheckpointTracker tracker;
+    if (ParseInput(m_builder, parser, tracker) == ParseStop::End) {
+        m_stopped = true;
+        m_pending.clear();
+    } else {
+        m_pending.erase(0, parser.position());
+    }
+}
+
+ParsedBatch ParseInputDocBatch(const std::vector<BatchInput>& inputs, ThreadPool& pool) {
+    size_t totalInput = 0;
+    for (const BatchInput& input : inputs) totalInput += input.text.size();
+    if (totalInput > UINT32_MAX) throw std::length_error("ParseInputDocBatch: input too long");
+
+    // Selectors are typically shared by the whole batch; parse the settings of each once.
+    std::unordered_map<const FontSelector*, std::shared_ptr<const CompiledStyleSettings>> settings;
+    for (const BatchInput& input : inputs) {
+        if (!settings.count(input.fs)) settings.emplace(input.fs, SettingsOf(*input.fs));
+    }
+
+    // Each worker parses into its own arena with a builder that it keeps across documents,
+    // so its buffers and style table are reused. Runs are positioned within the arena text.
+    struct WorkerArena {
+        DocumentBuilder builder;
+        std::wstring text;
+        std::vector<RunStyle> styles;
+        std::vector<BatchDocument> documents;
+    };
+    std::vector<WorkerArena> arenas(pool.Size());
+    std::vector<std::pair<uint32_t, uint32_t>> placement(inputs.size()); // arena, document in it
+
+    pool.ParallelFor(inputs.size(), 16, [&](size_t worker, size_t begin, size_t end) {
+        WorkerArena& arena = arenas[worker];
+        DocumentSink sink{
+            [&arena](const std::wstring_view& text) { arena.text.append(text); },
+            [&arena](const RunStyle& run, StyleSpan) { arena.styles.push_back(run); }
+        };
+        for (size_t j = begin; j < end; j++) {
+            const BatchInput& input = inputs[j];
+            DocumentBuilder& db = arena.builder;
+            BatchDocument doc{ static_cast<uint32_t>(arena.text.size()), 0, static_cast<uint32_t>(arena.styles.size()), 0, db.UnknownTags() };
+            BeginDocument(db, *settings.at(input.fs));
+            if (input.fs->parseEscapes) {
+                TextParser parser(input.text);
+                CheckpointTracker tracker;
+                ParseInput(db, parser, tracker);
+            } else {
+                db.Add(input.text);
+            }
+            db.EndDocument();
+            db.Drain(sink, true);
+            doc.textLength = static_cast<uint32_t>(arena.text.size() - doc.textBegin);
+            doc.runCount = static_cast<uint32_t>(arena.styles.size() - doc.runBegin);
+            doc.unknownTags = db.UnknownTags() - doc.unknownTags;
+            placement[j] = { static_cast<uint32_t>(worker), static_cast<uint32_t>(arena.documents.size()) };
+            arena.documents.push_back(doc);
+        }
+    });
+
+    ParsedBatch batch;
+    std::vector<std::vector<StyleId>> styleIds(arenas.size());
+    for (size_t w = 0; w < arenas.size(); w++) {
+        const StyleTable& table = arenas[w].builder.Styles();
+        for (StyleId id = 0; id < table.Size(); id++) {
+            StyleSpan set = table.Get(id);
+            styleIds[w].push_back(batch.styleTable.Intern(set.data(), set.size()));
+        }
+    }
+    size_t textSize = 0, runCount = 0;
+    batch.documents.reserve(inputs.size());
+    for (const auto& [w, d] : placement) {
+        BatchDocument doc = arenas[w].documents[d];
+        doc.textBegin = static_cast<uint32_t>(textSize);
+        doc.runBegin = static_cast<uint32_t>(runCount);
+        textSize += doc.textLength;
+        runCount += doc.runCount;
+        batch.documents.push_back(doc);
+    }
+    batch.text.resize(textSize);
+    batch.styles.resize(runCount);
+    pool.ParallelFor(inputs.size(), 256, [&](size_t, size_t begin, size_t end) {
+        for (size_t j = begin; j < end; j++) {
+            const WorkerArena& arena = arenas[placement[j].first];
+            const BatchDocument& from = arena.documents[placement[j].second];
+            const BatchDocument& to = batch.documents[j];
+            std::copy_n(arena.text.data() + from.textBegin, from.textLength, &batch.text[to.textBegin]);
+            for (uint32_t r = 0; r < from.runCount; r++) {
+                RunStyle run = arena.styles[from.runBegin + r];
+                run.cpBegin -= from.textBegin;
+                run.cpEnd -= from.textBegin;
+                run.style = styleIds[placement[j].first][run.style];
+                batch.styles[to.runBegin + r] = run;
+            }
+        }
+    });
+    return batch;
+}
+
+ParsedDocument ParseInputDocIncremental(ParsedDocument previous, SharedText input,
+    const FontSelector& fs, const DocumentEdit& edit, ParseOptions options) {
+    if (!fs.parseEscapes || previous.checkpoints.empty() || (options & ParseSegmentation)) return ParseInputDoc(std::move(input), fs, options);
+    if (edit.srcOldEnd < edit.srcBegin || edit.srcNewEnd < edit.srcBegin || edit.srcNewEnd > input->size())
+        return ParseInputDoc(std::move(input), fs, options);
+
+    // The token ending at a checkpoint may have peeked at the character right after it,
+    // so only checkpoints strictly before the edit are safe to resume from.
+    const auto& checkpoints = previous.checkpoints;
+    size_t resume = std::partition_point(checkpoints.begin() + 1, checkpoints.end(),
+        [&edit](const ParseCheckpoint& cp) { return cp.srcPos < edit.srcBegin; }) - checkpoints.begin() - 1;
+    size_t firstCandidate = std::partition_point(checkpoints.begin(), checkpoints.end(),
+        [&edit](const ParseCheckpoint& cp) { return cp.srcPos < edit.srcOldEnd; }) - checkpoints.begin();
+    const ParseCheckpoint& from = checkpoints[resume];
+
+    ParsedDocument doc;
+    doc.checkpoints.edit().assign(checkpoints.begin(), checkpoints.begin() + resume + 1);
+
+    std::wstring_view source(*input);
+    DocumentBuilder db(input); // input outlives the builder's reference, see ParseInputDoc
+    db.Restore(previous, from);
+    TextParser parser(source, from.srcPos);
+    CheckpointTracker tracker(doc.checkpoints.edit(), from.srcPos);
+    ptrdiff_t srcDelta = ptrdiff_t(edit.srcNewEnd) - ptrdiff_t(edit.srcOldEnd);
+    tracker.ResyncWith(previous, firstCandidate, srcDelta);
+
+    if (ParseInput(db, parser, tracker) != ParseStop::Resynced) {
+        db.EndDocument();
+        db.Finish(doc);
+        doc.runIndex = RunIndex(doc.styles);
+        return doc;
+    }
+
+    // Past the resync point the old parse is valid, shifted by the change in text length.
+    const ParseCheckpoint& to = checkpoints[tracker.ResyncIndex()];
+    std::wstring_view tail = previous.text.substr(to.cpCurrent);
+    db.Add(tail);
+    db.Finish(doc);
+    int64_t cpDelta = int64_t(doc.text.size() - tail.size()) - int64_t(to.cpCurrent);
+    int64_t runDelta = int64_t(doc.styles.size()) - int64_t(to.runCount);
+    int64_t coalescedDelta = int64_t(doc.coalescedRuns) - int64_t(to.coalescedRuns);
+    int64_t unknownTagsDelta = int64_t(doc.unknownTags) - int64_t(to.unknownTags);
+
+    doc.coalescedRuns = static_cast<uint32_t>(previous.coalescedRuns + coalescedDelta);
+    doc.unknownTags = static_cast<uint32_t>(previous.unknownTags + unknownTagsDelta);
+    std::vector<RunStyle>& styles = doc.styles.edit();
+    if (to.lastRunStyle != NO_STYLE_ID) styles.back().cpEnd = static_cast<uint32_t>(previous.styles[to.runCount - 1].cpEnd + cpDelta);
+    styles.reserve(styles.size() + previous.styles.size() - to.runCount);
+    for (size_t j = to.runCount; j < previous.styles.size(); j++) {
+        RunStyle rs = previous.styles[j];
+        rs.cpBegin = static_cast<uint32_t>(rs.cpBegin + cpDelta);
+        rs.cpEnd = static_cast<uint32_t>(rs.cpEnd + cpDelta);
+        styles.push_back(rs);
+    }
+    for (size_t j = tracker.ResyncIndex(); j < checkpoints.size(); j++) {
+        ParseCheckpoint cp = checkpoints[j];
+        cp.srcPos = static_cast<uint32_t>(cp.srcPos + srcDelta);
+        cp.cpCurrent = static_cast<uint32_t>(cp.cpCurrent + cpDelta);
+        cp.cpRunBegin = static_cast<uint32_t>(cp.cpRunBegin + cpDelta);
+        cp.runCount = static_cast<uint32_t>(cp.runCount + runDelta);
+        cp.coalescedRuns = static_cast<uint32_t>(cp.coalescedRuns + coalescedDelta);
+        cp.unknownTags = static_cast<uint32_t>(cp.unknownTags + unknownTagsDelta);
+        doc.checkpoints.edit().push_back(cp);
+    }
+    doc.runIndex = RunIndex(doc.styles);
+    return doc;
 }
 
 void DocumentBuilder::Add(wchar_t wch) {
-    m_stream << wch;
+    if (m_segmenter) m_segmenter->Add(wch);
+    if (m_source) {
+        if (m_current < m_source->size() && (*m_source)[m_current] == wch) {
+            m_current += 1;
+            return;
+        }
+        Detach();
+    }
+    m_text.push_back(wch);
     m_current += 1;
 }
 
+void DocumentBuilder::Add(const std::wstring_view& span) {
+    if (m_segmenter) m_segmenter->Add(span.data(), span.size());
+    if (m_source) {
+        // Plain spans of the source arrive in place; the content check covers everything else.
+        if (span.data() == m_source->data() + m_current || m_source->compare(m_current, span.size(), span) == 0) {
+            m_current += static_cast<uint32_t>(span.size());
+            return;
+        }
+        Detach();
+    }
+    m_text.append(span);
+    m_current += static_cast<uint32_t>(span.size());
+}
+
+void DocumentBuilder::Detach() {
+    m_text.reserve(m_source->size());
+    m_text.assign(*m_source, 0, m_current);
+    m_source.reset();
+}
+
 void DocumentBuilder::Flush() {
     if (m_runStyleStack.empty()) return;
-    RunStyleState& top = m_runStyleStack.top();
+    StyleScope& top = m_runStyleStack.back();
     if (m_current > top.cpBegin) {
-        m_style.push_back(RunStyle{ top.cpBegin, m_current, top.style });
+        if (!m_style.empty() && m_style.back().cpEnd == top.cpBegin && m_style.back().style == top.style) {
+            m_style.back().cpEnd = m_current;
+            m_coalescedRuns++;
+        } else {
+            m_style.push_back(RunStyle{ top.cpBegin, m_current, top.style });
+        }
     }
     top.cpBegin = m_current;
 }
@@ -341,64 +784,178 @@ void DocumentBuilder::Flush() {
 void DocumentBuilder::BeginSubrun() {
     Flush();
     if (m_runStyleStack.empty()) {
-        m_runStyleStack.push(RunStyleState{ 0, {} });
+        m_runStyleStack.push_back(StyleScope{ m_current, m_styleTable.Intern(nullptr, 0) });
     } else {
-        m_runStyleStack.push(RunStyleState(m_runStyleStack.top()));
+        m_runStyleStack.push_back(StyleScope{ m_current, m_runStyleStack.back().style });
     }
-    m_runStyleStack.top().cpBegin = m_current;
 }
 
 void DocumentBuilder::EndSubrun() {
     Flush();
     if (m_runStyleStack.empty()) return;
-    m_runStyleStack.pop();
+    m_runStyleStack.pop_back();
     if (m_runStyleStack.empty()) return;
-    m_runStyleStack.top().cpBegin = m_current;
+    m_runStyleStack.back().cpBegin = m_current;
+}
+
+void DocumentBuilder::EndDocument() {
+    while (!m_runStyleStack.empty()) EndSubrun();
 }
 
 RunStyleState DocumentBuilder::GetCurrentStyle() {
-    if (m_runStyleStack.empty())
-        return RunStyleState();
-    else
-        return RunStyleState(m_runStyleStack.top());
+    if (m_runStyleStack.empty()) return RunStyleState();
+    const StyleScope& top = m_runStyleStack.back();
+    StyleSpan style = m_styleTable.Get(top.style);
+    return RunStyleState{ top.cpBegin, StyleEntries(style.begin(), style.end()), top.style };
 }
 
 void DocumentBuilder::Update(const RunStyleState& newStyle) {
     Flush();
     if (m_runStyleStack.empty()) return;
-    m_runStyleStack.top().cpBegin = m_current;
-    m_runStyleStack.top().style = newStyle.style;
+    StyleScope& top = m_runStyleStack.back();
+    top.cpBegin = m_current;
+    top.style = newStyle.styleId != NO_STYLE_ID ? newStyle.styleId : m_styleTable.Intern(newStyle.style.data(), newStyle.style.size());
+}
+
+void DocumentBuilder::Finish(ParsedDocument& doc) {
+    SharedText text = m_source ? std::move(m_source) : std::make_shared<const std::wstring>(std::move(m_text));
+    doc.text = std::wstring_view(*text).substr(0, m_current);
+    doc.storage = std::move(text);
+    doc.styles = std::move(m_style);
+    doc.styleTable = std::move(m_styleTable);
+    doc.coalescedRuns = m_coalescedRuns;
+    doc.unknownTags = m_unknownTags;
+    if (m_segmenter) {
+        m_segmenter->Finish(doc.segmentation);
+        m_segmenter.reset();
+    }
+    m_text.clear();
+    m_style.clear();
+    m_styleTable = StyleTable();
+    m_coalescedRuns = 0;
+    m_unknownTags = 0;
+}
+
+void DocumentBuilder::Drain(const DocumentSink& sink, bool final) {
+    if (!m_text.empty()) {
+        if (sink.text) sink.text(m_text);
+        m_text.clear();
+    }
+    size_t ready = final || m_style.empty() ? m_style.size() : m_style.size() - 1;
+    if (sink.run) {
+        for (size_t j = 0; j < ready; j++) sink.run(m_style[j], m_styleTable.Get(m_style[j].style));
+    }
+    m_style.erase(m_style.begin(), m_style.begin() + ready);
+}
+
+bool DocumentBuilder::IsTopLevel() {
+    return m_runStyleStack.size() == 1;
+}
+
+ParseCheckpoint DocumentBuilder::Checkpoint(uint32_t srcPos) {
+    const StyleScope& top = m_runStyleStack.back();
+    return ParseCheckpoint{ srcPos, m_current, top.cpBegin, static_cast<uint32_t>(m_style.size()),
+        top.style, LastRunStyle(), m_coalescedRuns, m_unknownTags };
 }
 
-std::wstring DocumentBuilder::GetText() {
-    return m_stream.str();
+bool DocumentBuilder::Matches(const ParseCheckpoint& cp) {
+    if (!IsTopLevel()) return false;
+    const StyleScope& top = m_runStyleStack.back();
+    return m_current - top.cpBegin == cp.cpCurrent - cp.cpRunBegin
+        && top.style == cp.style && LastRunStyle() == cp.lastRunStyle;
 }
 
-std::vector<RunStyle> DocumentBuilder::GetStyles() {
-    return std::vector<RunStyle>(m_style);
+StyleId DocumentBuilder::LastRunStyle() {
+    if (m_style.empty() || m_style.back().cpEnd != m_runStyleStack.back().cpBegin) return NO_STYLE_ID;
+    return m_style.back().style;
+}
+
+void DocumentBuilder::Restore(ParsedDocument& doc, const ParseCheckpoint& cp) {
+    m_text.clear();
+    m_current = 0;
+    Add(doc.text.substr(0, cp.cpCurrent));
+    m_style.assign(doc.styles.begin(), doc.styles.begin() + cp.runCount);
+    // The last run may have been extended by coalescing after the checkpoint was taken.
+    if (cp.lastRunStyle != NO_STYLE_ID) m_style.back().cpEnd = cp.cpRunBegin;
+    m_coalescedRuns = cp.coalescedRuns;
+    m_unknownTags = cp.unknownTags;
+    m_styleTable = std::move(doc.styleTable);
+    m_current = cp.cpCurrent;
+    m_runStyleStack.assign(1, StyleScope{ cp.cpRunBegin, cp.style });
+}
+
+static uint32_t StyleKey(RunStyleType type, uint32_t tag) {
+    return RunStyleEntry(type, tag, 0).key;
+}
+
+static bool StyleKeyLess(const RunStyleEntry& entry, uint32_t key) {
+    return entry.key < key;
 }
 
 void RunStyleState::ClearStyles(RunStyleType type) {
-    std::vector<RunStyleEntry> newStyles;
-    std::copy_if(style.begin(), style.end(), std::back_inserter(newStyles),
-        [type](const RunStyleEntry& rs) {return rs.type != type; });
-    style = newStyles;
+    styleId = NO_STYLE_ID;
+    auto first = std::lower_bound(style.begin(), style.end(), StyleKey(type, 0), StyleKeyLess);
+    auto last = type == RunStyleType::Feature ? std::lower_bound(first, style.end(), RunStyleEntry::VARIATION_BIT, StyleKeyLess) : style.end();
+    style.erase(first, last);
 }
 
 void RunStyleState::ClearStyles(RunStyleType type, uint32_t tag) {
-    std::vector<RunStyleEntry> newStyles;
-    std::copy_if(style.begin(), style.end(), std::back_inserter(newStyles),
-        [type, tag](const RunStyleEntry& rs) {return rs.type != type || rs.tag != tag; });
-    style = newStyles;
-}
-
-void RunStyleState::SetStyle(RunStyleType type, uint32_t tag, double value) {
-    bool found = false;
-    for (auto& item : style) {
-        if (item.type == type && item.tag == tag) {
-            item.value = value;
-            found = true;
-        }
+    styleId = NO_STYLE_ID;
+    auto it = std::lower_bound(style.begin(), style.end(), StyleKey(type, tag), StyleKeyLess);
+    if (it != style.end() && it->key == StyleKey(type, tag)) style.erase(it, it + 1);
+}
+
+void RunStyleState::SetStyle(RunStyleType type, uint32_t tag, float value) {
+    styleId = NO_STYLE_ID;
+    auto it = std::lower_bound(style.begin(), style.end(), StyleKey(type, tag), StyleKeyLess);
+    if (it != style.end() && it->key == StyleKey(type, tag)) {
+        it->value = value;
+    } else {
+        style.insert(it, { type, tag, value });
+    }
+}
+
+static size_t HashStyle(const RunStyleEntry* entries, size_t count) {
+    uint64_t h = 14695981039346656037ull;
+    auto mix = [&h](uint64_t v) { h = (h ^ v) * 1099511628211ull; };
+    for (size_t j = 0; j < count; j++) {
+        uint64_t bits;
+        memcpy(&bits, &entries[j], sizeof bits);
+        mix(bits);
+    }
+    return static_cast<size_t>(h);
+}
+
+StyleTable StyleTable::Borrow(const uint32_t* offsets, size_t styleCount, const RunStyleEntry* entries) {
+    StyleTable table;
+    table.m_offsets = ImageVector<uint32_t>::Borrow(offsets, styleCount + 1);
+    table.m_entries = ImageVector<RunStyleEntry>::Borrow(entries, offsets[styleCount]);
+    return table;
+}
+
+StyleId StyleTable::Intern(const RunStyleEntry* entries, size_t count) {
+    auto byKey = [](const RunStyleEntry& a, const RunStyleEntry& b) { return a.key < b.key; };
+    if (!std::is_sorted(entries, entries + count, byKey)) {
+        std::vector<RunStyleEntry> sorted(entries, entries + count);
+        std::sort(sorted.begin(), sorted.end(), byKey);
+        return Intern(sorted.data(), sorted.size());
+    }
+    // A borrowed table starts without an index; sets are only added at the end, so the
+    // index holds ids [0, m_index.size()).
+    for (StyleId id = static_cast<StyleId>(m_index.size()); id < Size(); id++) {
+        StyleSpan set = Get(id);
+        m_index.emplace(HashStyle(set.data(), set.size()), id);
+    }
+    size_t hash = HashStyle(entries, count);
+    auto range = m_index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        StyleSpan set = Get(it->second);
+        if (std::equal(set.begin(), set.end(), entries, entries + count)) return it->second;
     }
-    if (!found) style.push_back({ type, tag, value });
+    StyleId id = static_cast<StyleId>(Size());
+    std::vector<RunStyleEntry>& pool = m_entries.edit();
+    pool.insert(pool.end(), entries, entries + count);
+    m_offsets.edit().push_back(static_cast<uint32_t>(pool.size()));
+    m_index.emplace(hash, id);
+    return id;
 }
@@ -1,49 +1,267 @@
 #pragma once
 #include "FontSelector.h"
+#include "SmallVector.h"
+#include "OpenTypeTag.h"
+#include "RunIndex.h"
+#include "ThreadPool.h"
+#include "Segmentation.h"
 
 enum RunStyleType {
 	Feature = 1,
 	Variation = 2
 };
+// A feature or axis setting, packed into 8 bytes. Tags only hold ASCII word characters, so
+// the top bit of the tag is free to mark variations, which then sort after the features.
 struct RunStyleEntry {
-	RunStyleType type;
-	uint32_t     tag;
-	double       value;
+	static constexpr uint32_t VARIATION_BIT = 0x80000000;
+
+	uint32_t key;   // the tag, with VARIATION_BIT set for a variation
+	float    value; // feature values are integers, which a float holds exactly up to 2^24
+
+	RunStyleEntry() = default;
+	constexpr RunStyleEntry(RunStyleType type, uint32_t tag, float value)
+		: key(type == RunStyleType::Variation ? tag | VARIATION_BIT : tag), value(value) {}
+
+	RunStyleType Type() const { return key & VARIATION_BIT ? RunStyleType::Variation : RunStyleType::Feature; }
+	uint32_t Tag() const { return key & ~VARIATION_BIT; }
+};
+inline bool operator==(const RunStyleEntry& a, const RunStyleEntry& b) {
+	return a.key == b.key && a.value == b.value;
+}
+
+// The entries of an interned style set, valid until the table is changed.
+struct StyleSpan {
+	const RunStyleEntry* first;
+	const RunStyleEntry* last;
+
+	const RunStyleEntry* begin() const { return first; }
+	const RunStyleEntry* end() const { return last; }
+	const RunStyleEntry* data() const { return first; }
+	size_t size() const { return last - first; }
+	bool empty() const { return first == last; }
+};
+inline bool operator==(const StyleSpan& a, const StyleSpan& b) {
+	return std::equal(a.first, a.last, b.first, b.last);
+}
+
+using StyleId = uint32_t;
+constexpr StyleId NO_STYLE_ID = UINT32_MAX;
+
+// Stores each distinct style set once, with its entries sorted by (type, tag), back to back
+// in one pool. Runs refer to a set by its id, which stays valid for the lifetime of the table.
+class StyleTable {
+public:
+	// A table over the pool and offsets of a stored one, which must outlive the table. The
+	// lookup index is built on the first Intern.
+	static StyleTable Borrow(const uint32_t* offsets, size_t styleCount, const RunStyleEntry* entries);
+
+	StyleId Intern(const RunStyleEntry* entries, size_t count);
+	StyleSpan Get(StyleId id) const { return { m_entries.data() + m_offsets[id], m_entries.data() + m_offsets[id + 1] }; }
+	size_t Size() const { return m_offsets.size() - 1; }
+
+private:
+	ImageVector<RunStyleEntry> m_entries;
+	ImageVector<uint32_t> m_offsets{ std::vector<uint32_t>{ 0 } }; // set id holds the entries [m_offsets[id], m_offsets[id + 1])
+	std::unordered_multimap<size_t, StyleId> m_index; // by hash; holds the first m_index.size() ids
 };
+
+// Sorted by (type, tag); typical styles fit inline, so copying a state does not allocate.
+using StyleEntries = SmallVector<RunStyleEntry, 8>;
+
 struct RunStyleState {
-	uint32_t                   cpBegin;
-	std::vector<RunStyleEntry> style;
+	uint32_t     cpBegin;
+	StyleEntries style;
+	StyleId      styleId = NO_STYLE_ID; // interned id of style, if known
 	void ClearStyles(RunStyleType type);
 	void ClearStyles(RunStyleType type, uint32_t tag);
-	void SetStyle(RunStyleType type, uint32_t tag, double value);
+	void SetStyle(RunStyleType type, uint32_t tag, float value);
 };
 struct RunStyle {
-	uint32_t                   cpBegin;
-	uint32_t                   cpEnd;
-	std::vector<RunStyleEntry> style;
+	uint32_t cpBegin;
+	uint32_t cpEnd;
+	StyleId  style;
+};
+// A token boundary in the source where the parser is back at the top-level scope.
+// Parsing from here on depends only on this state and on the source after srcPos,
+// so it is a safe point to resume from after an edit.
+struct ParseCheckpoint {
+	uint32_t                   srcPos;
+	uint32_t                   cpCurrent;
+	uint32_t                   cpRunBegin;
+	uint32_t                   runCount;
+	StyleId                    style;
+	StyleId                    lastRunStyle;  // style of the last run if it ends at cpRunBegin
+	uint32_t                   coalescedRuns;
+	uint32_t                   unknownTags;
+};
+// A syntax error in a settings string.
+struct StyleSettingsError {
+	bool     failed = false;
+	uint32_t position = 0; // offset into the settings string where parsing stopped
 };
+// The user feature and variation settings of a FontSelector, parsed once when they change and
+// applied as the root style of every document.
+struct CompiledStyleSettings {
+	std::wstring       featureSettings;   // the settings compiled
+	std::wstring       variationSettings;
+	RunStyleState      root;
+	uint32_t           unknownTags = 0;
+	StyleSettingsError featureError;      // settings with an error are ignored as a whole
+	StyleSettingsError variationError;
+
+	bool Matches(const FontSelector& fs) const;
+};
+// Compiles the selector's current settings, to be stored in its compiledSettings. Documents
+// parsed with a selector whose compiledSettings are missing or stale compile them on the fly.
+std::shared_ptr<const CompiledStyleSettings> CompileStyleSettings(const FontSelector& fs);
+
+using SharedText = std::shared_ptr<const std::wstring>;
+
+// Version of the parser output. Bump it whenever the same input and settings may parse into
+// different text or runs, which invalidates the documents cached by earlier versions.
+constexpr uint32_t DOC_PARSER_VERSION = 1;
+
 struct ParsedDocument {
-	std::wstring text;
-	std::vector<RunStyle> styles;
+	std::wstring_view text;       // points into storage
+	std::shared_ptr<const void> storage; // owns the text: the parsed input itself if parsing left it unchanged,
+	                                     // an owned copy, or a document cache image
+	ImageVector<RunStyle> styles; // disjoint and sorted; adjacent runs never share a style id
+	RunIndex runIndex;            // over styles
+	StyleTable styleTable;
+	ImageVector<ParseCheckpoint> checkpoints; // like the runs and styles, may be borrowed from storage
+	uint32_t coalescedRuns = 0;   // runs merged into the previous one because the style did not change
+	uint32_t unknownTags = 0;     // feature or axis tags, including the user settings, that are not registered OpenType tags
+	TextSegmentation segmentation; // of text, if parsed with ParseSegmentation
+};
+struct BatchInput {
+	std::wstring_view   text;
+	const FontSelector* fs;
+};
+// A document within a ParsedBatch. Its runs are positioned relative to its own text.
+struct BatchDocument {
+	uint32_t textBegin;
+	uint32_t textLength;
+	uint32_t runBegin;
+	uint32_t runCount;
+	uint32_t unknownTags;
+};
+struct ParsedBatch {
+	std::wstring text;                    // the text of every document, back to back
+	std::vector<RunStyle> styles;         // the runs of every document, back to back
+	StyleTable styleTable;                // shared by all documents
+	std::vector<BatchDocument> documents; // in input order
+};
+// Source range [srcBegin, srcOldEnd) of the previous input was replaced by [srcBegin, srcNewEnd).
+struct DocumentEdit {
+	uint32_t srcBegin;
+	uint32_t srcOldEnd;
+	uint32_t srcNewEnd;
+};
+
+// Receives a document piece by piece. Text arrives in order; each run arrives once it can
+// no longer change, together with its style entries, and only after the text it covers.
+struct DocumentSink {
+	std::function<void(const std::wstring_view& text)> text;
+	std::function<void(const RunStyle& run, StyleSpan style)> run;
 };
 
 class DocumentBuilder {
 public:
+	DocumentBuilder() = default;
+	explicit DocumentBuilder(size_t reserveText) { m_text.reserve(reserveText); }
+	// Builds on top of source: while the text added so far is a prefix of source, it is
+	// referred to instead of copied.
+	explicit DocumentBuilder(SharedText source) : m_source(std::move(source)) {}
+
 	void Add(wchar_t wch);
+	void Add(const std::wstring_view& span);
 	void Flush();
 	void BeginSubrun();
 	void EndSubrun();
+	// Closes the root scope along with any scopes an unbalanced "\{" left open.
+	void EndDocument();
 	RunStyleState GetCurrentStyle();
 	void Update(const RunStyleState& newStyle);
-	std::wstring GetText();
-	std::vector<RunStyle> GetStyles();
+	void CountUnknownTags(uint32_t count) { m_unknownTags += count; }
+	uint32_t UnknownTags() const { return m_unknownTags; }
+	const StyleTable& Styles() const { return m_styleTable; }
+	// Segments the text added from now on; Finish hands the boundaries to the document.
+	void EnableSegmentation() { m_segmenter = std::make_unique<TextSegmenter>(); }
+	// Moves the built text, runs and style table out; the builder is empty afterwards.
+	void Finish(ParsedDocument& doc);
+	// Hands the text and the completed runs built so far to the sink and forgets them.
+	// Unless final, the last run is held back since following text may still extend it.
+	void Drain(const DocumentSink& sink, bool final);
+
+	bool IsTopLevel();
+	ParseCheckpoint Checkpoint(uint32_t srcPos);
+	bool Matches(const ParseCheckpoint& cp);
+	void Restore(ParsedDocument& doc, const ParseCheckpoint& cp);
 
 private:
-	std::stack<RunStyleState> m_runStyleStack;
+	// A scope refers to its interned style set, which is immutable and shared with the
+	// enclosing scope until it is changed, so opening a scope copies no entries.
+	struct StyleScope {
+		uint32_t cpBegin;
+		StyleId  style;
+	};
+
+	StyleId LastRunStyle();
+	void Detach();
 
-	std::wstringstream m_stream;
+	std::vector<StyleScope> m_runStyleStack;
+
+	std::unique_ptr<TextSegmenter> m_segmenter;
+	SharedText m_source; // while set, the text is the first m_current characters of it and m_text is unused
+	std::wstring m_text;
 	std::vector<RunStyle> m_style;
+	StyleTable m_styleTable;
 	uint32_t m_current = 0;
+	uint32_t m_coalescedRuns = 0;
+	uint32_t m_unknownTags = 0;
 };
 
-ParsedDocument ParseInputDoc(const std::wstring_view& input, const FontSelector& fs);
+enum ParseOptions : uint32_t {
+	ParseDefault = 0,
+	ParseSegmentation = 1 // segment the text while it is built, in the same pass
+};
+
+ParsedDocument ParseInputDoc(const std::wstring_view& input, const FontSelector& fs, ParseOptions options = ParseDefault);
+// Same as above, but the result shares input instead of copying it when parsing does not
+// change the text, i.e. when escapes are off or the input contains none.
+ParsedDocument ParseInputDoc(SharedText input, const FontSelector& fs, ParseOptions options = ParseDefault);
+
+// Parses many independent inputs on the pool's threads into one result. The settings of each
+// distinct FontSelector are compiled at most once for the whole batch.
+ParsedBatch ParseInputDocBatch(const std::vector<BatchInput>& inputs, ThreadPool& pool = ThreadPool::Shared());
+
+// Re-parses only the part of the input affected by the edit, reusing the rest of the
+// previous document, which must come from the same FontSelector. The result is identical
+// to ParseInputDoc. Pass the previous document by move to avoid copying its runs.
+// Segmentation is not kept at checkpoints, so asking for it parses the whole input.
+ParsedDocument ParseInputDocIncremental(ParsedDocument previous, SharedText input,
+	const FontSelector& fs, const DocumentEdit& edit, ParseOptions options = ParseDefault);
+
+// Parses a document that arrives in chunks, such as a very large file or a pipe, while
+// keeping only the unconsumed tail of the input and the current run in memory. An escape
+// sequence split across chunks is held until the chunk completing it arrives. Output is
+// the same as ParseInputDoc on the concatenated input.
+class DocumentStreamParser {
+public:
+	DocumentStreamParser(const FontSelector& fs, DocumentSink sink);
+
+	void Feed(const std::wstring_view& chunk);
+	// Parses whatever input is still pending and delivers the rest of the document.
+	void Finish();
+	uint32_t UnknownTags() const { return m_builder.UnknownTags(); }
+
+private:
+	void Parse(bool final);
+
+	DocumentSink m_sink;
+	DocumentBuilder m_builder;
+	std::wstring m_pending;
+	bool m_parseEscapes;
+	bool m_stopped = false;
+	bool m_finished = false;
+};
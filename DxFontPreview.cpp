@@ -13,6 +13,7 @@
 #include "resource.h"
 #include "WindowUtil.h"
 #include "DxFontPreview.h"
+#include "TextFile.h"
 
 ////////////////////////////////////////
 // Main entry.
@@ -69,6 +70,11 @@ WPARAM MainWindow::RunMessageLoop() {
         if (!messageHandled && msg.message == WM_KEYDOWN && msg.wParam == VK_RETURN) {
             messageHandled = !SendMessage(dialog, msg.message, msg.wParam, msg.lParam);
         }
+        // Wheel messages go to the control with focus, which the canvas never has, so let the
+        // dialog scroll the canvas first when the pointer is over it.
+        if (!messageHandled && msg.message == WM_MOUSEWHEEL) {
+            messageHandled = !!SendMessage(dialog, msg.message, msg.wParam, msg.lParam);
+        }
         if (!messageHandled) {
             // Let the default dialog processing check it.
             messageHandled = !!IsDialogMessage(dialog, &msg);
@@ -89,26 +95,19 @@ void MainWindow::Initialize() {
     ShowWindow(m_hwnd, SW_SHOWNORMAL);
     UpdateWindow(m_hwnd);
 
-    // Initialize the render target.
-    {
-        wil::com_ptr< IDWriteGdiInterop> gdiInterop;
-        THROW_IF_FAILED(m_dwriteFactory->GetGdiInterop(&gdiInterop));
-
-        RECT clientRect;
-        GetClientRect(m_hwnd, &clientRect);
-
-        HDC hdc = GetDC(m_hwnd);
-        THROW_IF_FAILED(gdiInterop->CreateBitmapRenderTarget(hdc, clientRect.right, clientRect.bottom, &m_renderTarget));
-        ReleaseDC(m_hwnd, hdc);
-    }
-
-    // Create our custom layout, source, and sink.
+    // Create our font source, and the pipeline that lays out and draws off this thread.
 
     m_fontSource = std::make_unique<FlowFontSource>(m_dwriteFactory);
-    m_textLayout = std::make_unique<TextLayout>(m_dwriteFactory);
-    
-    THROW_IF_NULL_ALLOC(m_textLayout);
+    m_renderer = std::make_unique<PreviewRenderer>(m_dwriteFactory);
+    HWND hwnd = m_hwnd;
+    m_pipeline = std::make_unique<PreviewRenderer::Pipeline>(m_renderer->Stages(), [hwnd](PreviewFrame&& frame, uint64_t sequence) {
+        // The window owns the frame once the message is posted.
+        auto posted = std::make_unique<PreviewFrame>(std::move(frame));
+        if (PostMessage(hwnd, WmPreviewFrame, WPARAM(sequence), LPARAM(posted.get()))) posted.release();
+    });
+
     THROW_IF_NULL_ALLOC(m_fontSource);
+    THROW_IF_NULL_ALLOC(m_pipeline);
 
     auto scaffold = CreateUiScaffold();
     HFONT hFontEdit = CreateFont(scaffold.scaleDpi(16), 0, 0, 0, FW_DONTCARE, FALSE, FALSE, FALSE, ANSI_CHARSET,
@@ -171,6 +170,10 @@ MainWindow::DialogProcResult CALLBACK MainWindow::DialogProc(HWND hwnd, UINT mes
         }
         break;
 
+    case WM_DESTROY:
+        OnDestroy();
+        break;
+
     case WM_NCDESTROY:
         delete this; // do NOT reference class after this
         PostQuitMessage(0);
@@ -183,6 +186,14 @@ MainWindow::DialogProcResult CALLBACK MainWindow::DialogProc(HWND hwnd, UINT mes
         OnDropFiles((HDROP)wParam);
         return true;
 
+    case WM_MOUSEWHEEL:
+        if (!OnMouseWheel(GET_WHEEL_DELTA_WPARAM(wParam), POINT{ GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam) })) return false;
+        return DialogProcResult(true, 1);
+
+    case WmPreviewFrame:
+        OnPreviewFrame(uint64_t(wParam), std::unique_ptr<PreviewFrame>((PreviewFrame*)lParam));
+        break;
+
     default:
         return false; // unhandled.
     }
@@ -367,7 +378,6 @@ void MainWindow::UnloadCustomFonts() {
     m_fontSource->UseSystem();
     m_fontSelector.familyName = L"Calibri";
     m_fontSelector.styleName = L"Regular";
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     DeferUpdateUi(NeedUpdateUi::FontSource | NeedUpdateUi::FontSelector);
     ReflowLayout();
 }
@@ -375,7 +385,6 @@ void MainWindow::UnloadCustomFonts() {
 void MainWindow::ReloadFontSource() {
     auto filePaths = m_fontSource->GetCurrentFilePaths();
     if (filePaths.size()) m_fontSource->UseFiles(filePaths);
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     DeferUpdateUi(NeedUpdateUi::FontSource | NeedUpdateUi::FontSelector);
     ReflowLayout();
 }
@@ -396,20 +405,41 @@ void MainWindow::OnDropFiles(HDROP drop) {
         if (buffer.size()) filePaths.push_back(std::wstring(&buffer[0]));
     }
 
-    if (!m_textLayout) return;
-    
-    m_fontSource->UseFiles(filePaths);
+    if (!m_pipeline) return;
+
+    // Dropped text files replace the sample text, everything else is taken as a font file.
+    std::vector<std::wstring> fontPaths;
+    SharedText sampleText;
+    for (const auto& path : filePaths) {
+        size_t dot = path.find_last_of(L".\\/");
+        if (dot != std::wstring::npos && _wcsicmp(path.c_str() + dot, L".txt") == 0) {
+            sampleText = TextFile::LoadUtf8(path);
+        } else {
+            fontPaths.push_back(path);
+        }
+    }
+
+    if (sampleText) {
+        // Another document, which the pipeline parses, and shows from its beginning.
+        m_text = std::move(sampleText);
+        m_document++;
+        m_scrollSteps.clear();
+        DeferUpdateUi(NeedUpdateUi::Text);
+    }
+    if (fontPaths.empty()) {
+        ReflowLayout();
+        return;
+    }
+
+    m_fontSource->UseFiles(fontPaths);
     m_fontSource->GetDefaultSelector(m_fontSelector);
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
-        
 
     DeferUpdateUi(NeedUpdateUi::FontSource | NeedUpdateUi::FontSelector);
     ReflowLayout();
 }
 
 void MainWindow::OnTextChange() {
-    std::wstring userText = WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcEditText));
-    m_textLayout->SetText(userText.c_str(), userText.size());
+    m_text = std::make_shared<const std::wstring>(WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcEditText)));
     ReflowLayout();
 }
 
@@ -430,7 +460,6 @@ void MainWindow::OnFontFamilyChange(const uint32_t& wmEvent) {
         }
     }
 
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
     DeferUpdateUi(NeedUpdateUi::FontStyle);
 }
@@ -441,7 +470,6 @@ void MainWindow::OnLocaleChange(const uint32_t& wmEvent) {
     } else {
         m_fontSelector.localeName = WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcSelectLocale));
     }
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
@@ -451,7 +479,6 @@ void MainWindow::OnFontStyleChange(const uint32_t& wmEvent) {
     } else {
         m_fontSelector.styleName = WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcSelectStyle));
     }
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
@@ -465,51 +492,53 @@ void MainWindow::OnFontSizeChange(const uint32_t& wmEvent) {
 
 void MainWindow::OnFontDirectionChange(const uint32_t& wmEvent) {
     m_fontSelector.readingDirection = ReadingDirection(wmEvent - CommandIdDirectionLeftToRightTopToBottom); 
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
 void MainWindow::OnFeaturesEnabledChange() {
     m_fontSelector.userFeaturesEnabled = !!IsDlgButtonChecked(m_hwnd, IdcCheckFeatureEnabled);
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     DeferUpdateUi(NeedUpdateUi::FontFeatureSettings);
     ReflowLayout();
 }
 
 void MainWindow::OnFontFeatureSettingsChange() {
     m_fontSelector.userFeatureSettings = WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcEditFeatureSettings));
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
+    m_fontSelector.compiledSettings = CompileStyleSettings(m_fontSelector);
+    ShowSettingsError(IdcEditFeatureSettings, m_fontSelector.compiledSettings->featureError);
     ReflowLayout();
 }
 
 void MainWindow::OnVariationEnabledChange() {
     m_fontSelector.userVariationEnabled = !!IsDlgButtonChecked(m_hwnd, IdcCheckVariationEnabled);
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     DeferUpdateUi(NeedUpdateUi::FontVariationSettings);
     ReflowLayout();
 }
 
 void MainWindow::OnFontVariationSettingsChange() {
     m_fontSelector.userVariationSettings = WinUtil::GetValueOfTextBox(GetDlgItem(m_hwnd, IdcEditVariationSettings));
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
+    m_fontSelector.compiledSettings = CompileStyleSettings(m_fontSelector);
+    ShowSettingsError(IdcEditVariationSettings, m_fontSelector.compiledSettings->variationError);
     ReflowLayout();
 }
 
+void MainWindow::ShowSettingsError(uint32_t idc, const StyleSettingsError& error) {
+    std::wstring message;
+    if (error.failed) message = L"Syntax error at character " + std::to_wstring(error.position + 1) + L". These settings are ignored.";
+    WinUtil::SetTextBoxTip(GetDlgItem(m_hwnd, idc), L"Invalid settings", message);
+}
+
 void MainWindow::ToggleFontFallback() {
     m_fontSelector.doFontFallback = !m_fontSelector.doFontFallback;
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
 void MainWindow::ToggleJustify() {
     m_fontSelector.doJustify = !m_fontSelector.doJustify;
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
 void MainWindow::ToggleEsacpe() {
     m_fontSelector.parseEscapes = !m_fontSelector.parseEscapes;
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
     ReflowLayout();
 }
 
@@ -527,7 +556,6 @@ void MainWindow::OnSelectNumber(uint32_t idc, const uint32_t& wmEvent,
     } else {
         fnSet(m_fontSelector, int(WinUtil::GetNumOfTextBox(GetDlgItem(m_hwnd, idc), current)));
     }
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
 }
 
 void MainWindow::OnSelectIndex(uint32_t idc, uint32_t min, uint32_t max, std::function<void(FontSelector&, uint32_t)> fn) {
@@ -535,8 +563,6 @@ void MainWindow::OnSelectIndex(uint32_t idc, uint32_t min, uint32_t max, std::fu
     if (currentIndex >= min && currentIndex <= max) {
         fn(m_fontSelector, currentIndex);
     }
-
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
 };
 
 
@@ -581,18 +607,42 @@ void MainWindow::OnSize()
 
     WinUtil::AmendComboBoxItemWidth(GetDlgItem(hwnd, IdcSelectStyle));
 
-    // Resizes the render target and flow source.
+    // The snapshot takes the new canvas size.
+    ReflowLayout();
+}
+
+bool MainWindow::OnMouseWheel(int delta, POINT screenPoint) {
     RECT canvasRect;
-    GetClientRect(GetDlgItem(hwnd, IdcDrawingCanvas), &canvasRect);
-    if (m_renderTarget != nullptr) {
-        m_renderTarget->Resize(canvasRect.right, canvasRect.bottom);
-    }
-    if (m_textLayout != nullptr) {
-        float pixelsPerDip = m_renderTarget->GetPixelsPerDip();
-        m_textLayout->SetSize(float(canvasRect.right) / pixelsPerDip, float(canvasRect.bottom) / pixelsPerDip);
-    }
+    GetWindowRect(GetDlgItem(m_hwnd, IdcDrawingCanvas), &canvasRect);
+    if (m_pipeline == nullptr || !PtInRect(&canvasRect, screenPoint)) return false;
 
+    // Three lines of the current size per notch; rolling the wheel back moves toward the end.
+    m_scrollSteps.push_back({ ++m_scrollStepCount, -float(delta) / WHEEL_DELTA * 3 * m_fontSelector.fontEmSize });
     ReflowLayout();
+    return true;
+}
+
+void MainWindow::OnPreviewFrame(uint64_t sequence, std::unique_ptr<PreviewFrame> frame) {
+    // The renderer has applied the steps up to this one, and skips them in later snapshots.
+    auto applied = std::find_if(m_scrollSteps.begin(), m_scrollSteps.end(), [&](const ScrollStep& step) { return step.number > frame->scrollStep; });
+    m_scrollSteps.erase(m_scrollSteps.begin(), applied);
+
+    // Frames come in the order of their snapshots. One that finished after a newer snapshot was
+    // submitted is still newer than what is shown, so show it rather than wait.
+    if (sequence <= m_shownFrame) return;
+    m_shownFrame = sequence;
+    HBITMAP bitmap = frame->bitmap.release();
+    HBITMAP bitmapOld = (HBITMAP) SendDlgItemMessage(m_hwnd, IdcDrawingCanvas, STM_SETIMAGE, IMAGE_BITMAP, (LPARAM)bitmap);
+    if (bitmapOld && bitmapOld != bitmap) DeleteObject(bitmapOld);
+}
+
+void MainWindow::OnDestroy() {
+    // Stop the pipeline first, so that no frame is posted once the queue is drained.
+    m_pipeline.reset();
+    MSG msg;
+    while (PeekMessage(&msg, m_hwnd, WmPreviewFrame, WmPreviewFrame, PM_REMOVE)) delete (PreviewFrame*)msg.lParam;
+    HBITMAP bitmap = (HBITMAP) SendDlgItemMessage(m_hwnd, IdcDrawingCanvas, STM_SETIMAGE, IMAGE_BITMAP, 0);
+    if (bitmap) DeleteObject(bitmap);
 }
 
 void MainWindow::OnMove()
@@ -626,25 +676,30 @@ void MainWindow::UpdateRenderingMode() {
 }
 
 void MainWindow::ReflowLayout() {
+    if (m_pipeline == nullptr) return; // Not initialized yet.
     RECT canvasRect;
     HWND hwndStatic = GetDlgItem(m_hwnd, IdcDrawingCanvas);
     GetClientRect(hwndStatic, &canvasRect);
-    HDC memoryHdc = m_renderTarget->GetMemoryDC();
-
-    // Clear background.
-    SetDCBrushColor(memoryHdc, GetSysColor(COLOR_WINDOW));
-    SelectObject(memoryHdc, GetStockObject(NULL_PEN));
-    SelectObject(memoryHdc, GetStockObject(DC_BRUSH));
-    Rectangle(memoryHdc, 0, 0, canvasRect.right, canvasRect.bottom);
 
-    // Draw all of the produced glyph runs.
-    m_textLayout->Render(m_renderTarget, m_renderingParams, m_markingsOptions);
+    // The source moves on to the next font set while the pipeline may still be drawing with the
+    // old one, so snapshots get a copy of it, which keeps the old font set usable.
+    if (!m_fontSourceSnapshot || m_fontSourceSnapshot->Generation() != m_fontSource->Generation())
+        m_fontSourceSnapshot = std::make_shared<const FlowFontSource>(*m_fontSource);
 
-    // Blit
-    HBITMAP bitmapSrc = (HBITMAP) GetCurrentObject(memoryHdc, OBJ_BITMAP);
-    HBITMAP bitmapCopy = (HBITMAP)CopyImage(bitmapSrc, IMAGE_BITMAP, 0, 0, LR_DEFAULTSIZE);
-    HBITMAP bitmapOld = (HBITMAP) SendDlgItemMessage(m_hwnd, IdcDrawingCanvas, STM_SETIMAGE, IMAGE_BITMAP, (LPARAM)bitmapCopy);
-    if (bitmapOld && bitmapOld != bitmapCopy) DeleteObject(bitmapOld);
+    // Newer snapshots replace this one if it has not been drawn by then. The frame comes back
+    // as WmPreviewFrame.
+    PreviewSnapshot snapshot;
+    snapshot.fontSelector = m_fontSelector;
+    snapshot.fontSource = m_fontSourceSnapshot;
+    snapshot.text = m_text;
+    snapshot.document = m_document;
+    snapshot.scrollSteps = m_scrollSteps;
+    snapshot.width = canvasRect.right;
+    snapshot.height = canvasRect.bottom;
+    snapshot.markings = m_markingsOptions;
+    snapshot.renderingParams = m_renderingParams;
+    snapshot.background = GetSysColor(COLOR_WINDOW);
+    m_pipeline->Submit(std::move(snapshot));
 }
 
 
@@ -690,10 +745,10 @@ void MainWindow::SetLayoutText(bool fInit, const UINT& commandId)
         m_fontSelector.fontEmSize = 72;
         m_fontSelector.userFeaturesEnabled = true;
         m_fontSelector.userFeatureSettings = L"calt, liga, clig, kern";
+        m_fontSelector.compiledSettings = CompileStyleSettings(m_fontSelector);
     }
 
-    m_textLayout->SetFont(*m_fontSource, m_fontSelector);
-    m_textLayout->SetText(text, static_cast<UINT32>(wcsnlen(text, UINT32_MAX)));
+    m_text = std::make_shared<const std::wstring>(text, wcsnlen(text, UINT32_MAX));
     
     if (!fInit) ReflowLayout();
     DeferUpdateUi(NeedUpdateUi::Text | NeedUpdateUi::FontSelector | NeedUpdateUi::FontSource);
@@ -892,8 +947,5 @@ void MainWindow::UpdateFontSource() {
 }
 
 void MainWindow::UpdateEditText() {
-    const WCHAR* text;
-    UINT32 size;
-    m_textLayout->GetText(&text, &size);
-    SendMessage(GetDlgItem(m_hwnd, IdcEditText), WM_SETTEXT, 0, LPARAM(text));
+    SendMessage(GetDlgItem(m_hwnd, IdcEditText), WM_SETTEXT, 0, LPARAM(m_text->c_str()));
 }
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include "TextLayout.h"
+#include "PreviewRenderer.h"
 
 enum class NeedUpdateUi : uint32_t {
     None = 0,
@@ -49,9 +49,7 @@ public:
     :   m_hwnd(hwnd),
         m_hMonitor(NULL),
         m_dwriteFactory(),
-        m_renderingParams(),
-        m_renderTarget(),
-        m_textLayout()
+        m_renderingParams()
     { }
 
     static ATOM RegisterWindowClass();
@@ -62,6 +60,9 @@ public:
 
 public:
     const static wchar_t* g_windowClassName;
+    // Posted by the preview pipeline with a frame: wParam is its sequence number, lParam a
+    // PreviewFrame allocated with new, which the window deletes.
+    static constexpr UINT WmPreviewFrame = WM_APP + 1;
 
 protected:
     class UiScaffold {
@@ -98,6 +99,11 @@ protected:
     void UnloadCustomFonts();
     void ReloadFontSource();
     void OnDropFiles(HDROP drop);
+    // Scrolls the canvas if the point is over it.
+    bool OnMouseWheel(int delta, POINT screenPoint);
+    void OnPreviewFrame(uint64_t sequence, std::unique_ptr<PreviewFrame> frame);
+    // Stops the pipeline and frees the frames it posted and the one on the canvas.
+    void OnDestroy();
 
     void OnTextChange();
 	void OnFontFamilyChange(const uint32_t& wmEvent);
@@ -109,6 +115,7 @@ protected:
     void OnFontFeatureSettingsChange();
     void OnVariationEnabledChange();
     void OnFontVariationSettingsChange();
+    void ShowSettingsError(uint32_t idc, const StyleSettingsError& error);
     void ToggleFontFallback();
     void ToggleJustify();
     void ToggleEsacpe();
@@ -137,13 +144,23 @@ protected:
 
     wil::com_ptr<IDWriteFactory> m_dwriteFactory;
     wil::com_ptr<IDWriteRenderingParams> m_renderingParams;
-    wil::com_ptr<IDWriteBitmapRenderTarget> m_renderTarget;
 
     FontSelector m_fontSelector;
-    std::unique_ptr<TextLayout> m_textLayout;
     std::unique_ptr<FlowFontSource> m_fontSource;
+    // The copy of m_fontSource in the snapshots, made again when its font set changes.
+    std::shared_ptr<const FlowFontSource> m_fontSourceSnapshot;
+    SharedText m_text;
+    uint32_t m_document = 0; // counts the documents loaded, as opposed to edits of the text
+    // Wheel steps on the document that no frame has shown to be applied yet.
+    std::vector<ScrollStep> m_scrollSteps;
+    uint64_t m_scrollStepCount = 0;
     RenderMarkings m_markingsOptions = RenderMarkings::None;
 
+    // The layout lives on the pipeline thread; the window only submits snapshots to it.
+    std::unique_ptr<PreviewRenderer> m_renderer;
+    std::unique_ptr<PreviewRenderer::Pipeline> m_pipeline; // after the renderer, so it stops first
+    uint64_t m_shownFrame = 0;
+
 protected:
     HWND m_hwnd;
     HMONITOR m_hMonitor;
@@ -28,27 +28,7 @@ enum ReadingDirection {
     ReadingDirectionN = ReadingDirectionBottomToTopLeftToRight,
 };
 
-const static DWRITE_READING_DIRECTION g_dwriteReadingDirectionValues[8] = {
-    DWRITE_READING_DIRECTION_LEFT_TO_RIGHT,
-    DWRITE_READING_DIRECTION_RIGHT_TO_LEFT,
-    DWRITE_READING_DIRECTION_LEFT_TO_RIGHT,
-    DWRITE_READING_DIRECTION_RIGHT_TO_LEFT,
-    DWRITE_READING_DIRECTION_TOP_TO_BOTTOM,
-    DWRITE_READING_DIRECTION_BOTTOM_TO_TOP,
-    DWRITE_READING_DIRECTION_TOP_TO_BOTTOM,
-    DWRITE_READING_DIRECTION_BOTTOM_TO_TOP,
-};
-
-const static DWRITE_FLOW_DIRECTION g_dwriteFlowDirectionValues[8] = {
-    DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM,
-    DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM,
-    DWRITE_FLOW_DIRECTION_BOTTOM_TO_TOP,
-    DWRITE_FLOW_DIRECTION_BOTTOM_TO_TOP,
-    DWRITE_FLOW_DIRECTION_LEFT_TO_RIGHT,
-    DWRITE_FLOW_DIRECTION_LEFT_TO_RIGHT,
-    DWRITE_FLOW_DIRECTION_RIGHT_TO_LEFT,
-    DWRITE_FLOW_DIRECTION_RIGHT_TO_LEFT,
-};
+struct CompiledStyleSettings;
 
 class FontSelector {
 public:
@@ -60,6 +40,8 @@ public:
     std::wstring userFeatureSettings;
     bool userVariationEnabled = false;
     std::wstring userVariationSettings;
+    // The two settings above, parsed; see CompileStyleSettings.
+    std::shared_ptr<const CompiledStyleSettings> compiledSettings;
 
     ReadingDirection readingDirection = ReadingDirectionLeftToRightTopToBottom;
 
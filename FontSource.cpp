@@ -1,13 +1,19 @@
 #include "Common.h"
 #include "FontSource.h"
 
+FontLoaderRegistration::FontLoaderRegistration(wil::com_ptr<IDWriteFactory> dwriteFactory, wil::com_ptr<IDWriteInMemoryFontFileLoader> loader)
+    : m_dwriteFactory(dwriteFactory), m_loader(loader) {
+    THROW_IF_FAILED(m_dwriteFactory->RegisterFontFileLoader(m_loader.get()));
+}
+
+FontLoaderRegistration::~FontLoaderRegistration() {
+    LOG_IF_FAILED(m_dwriteFactory->UnregisterFontFileLoader(m_loader.get()));
+}
+
 void FlowFontSource::UseSystem() {
     m_currentFilePaths.clear();
-
-    if (!!m_memoryFontLoader) {
-        THROW_IF_FAILED(m_dwriteFactory->UnregisterFontFileLoader(m_memoryFontLoader.get()));
-        m_memoryFontLoader.reset();
-    }
+    m_generation++;
+    m_memoryFontLoader.reset();
 
     wil::com_ptr<IDWriteFactory3> factory3 = m_dwriteFactory.query<IDWriteFactory3>();
     factory3->GetSystemFontSet(&m_fontSet);
@@ -70,18 +76,14 @@ public:
 
 void FlowFontSource::UseFiles(const std::vector<std::wstring>& filePaths) {
     m_currentFilePaths = filePaths;
+    m_generation++;
 
-    if (!!m_memoryFontLoader) {
-        THROW_IF_FAILED(m_dwriteFactory->UnregisterFontFileLoader(m_memoryFontLoader.get()));
-        m_memoryFontLoader.reset();
-    }
-
+    // A new loader each time, so that the files of the old font set stay readable for as long
+    // as copies of this source refer to them.
     wil::com_ptr<IDWriteFactory5> factory5 = m_dwriteFactory.query<IDWriteFactory5>();
-
-    if (!m_memoryFontLoader) {
-        THROW_IF_FAILED(factory5->CreateInMemoryFontFileLoader(&m_memoryFontLoader));
-        THROW_IF_FAILED(factory5->RegisterFontFileLoader(m_memoryFontLoader.get()));
-    }
+    wil::com_ptr<IDWriteInMemoryFontFileLoader> loader;
+    THROW_IF_FAILED(factory5->CreateInMemoryFontFileLoader(&loader));
+    m_memoryFontLoader = std::make_shared<const FontLoaderRegistration>(m_dwriteFactory, loader);
 
     wil::com_ptr<IDWriteFontSetBuilder1> fontSetBuilder;
     THROW_IF_FAILED(factory5->CreateFontSetBuilder(&fontSetBuilder));
@@ -96,7 +98,7 @@ void FlowFontSource::UseFiles(const std::vector<std::wstring>& filePaths) {
         if(FAILED(file.ReadBytes(mf))) continue;
         wil::com_ptr<IDWriteFontFile> fontFileReference;
 
-        if(FAILED(m_memoryFontLoader->CreateInMemoryFontFileReference(factory5.get(), mf.m_buffer, mf.m_size, nullptr, &fontFileReference))) continue;
+        if(FAILED(m_memoryFontLoader->Get()->CreateInMemoryFontFileReference(factory5.get(), mf.m_buffer, mf.m_size, nullptr, &fontFileReference))) continue;
         if(FAILED(fontSetBuilder->AddFontFile(fontFileReference.get()))) continue;
     }
 
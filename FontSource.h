@@ -2,6 +2,25 @@
 
 #include "FontSelector.h"
 
+// Registers an in-memory font file loader with the factory for the lifetime of the object.
+// Font sets made from the loader's files only work while it is registered, so whatever uses
+// such a font set shares ownership of the registration.
+class FontLoaderRegistration {
+public:
+    FontLoaderRegistration(wil::com_ptr<IDWriteFactory> dwriteFactory, wil::com_ptr<IDWriteInMemoryFontFileLoader> loader);
+    ~FontLoaderRegistration();
+    FontLoaderRegistration(const FontLoaderRegistration&) = delete;
+    FontLoaderRegistration& operator=(const FontLoaderRegistration&) = delete;
+
+    IDWriteInMemoryFontFileLoader* Get() const { return m_loader.get(); }
+
+private:
+    wil::com_ptr<IDWriteFactory> m_dwriteFactory;
+    wil::com_ptr<IDWriteInMemoryFontFileLoader> m_loader;
+};
+
+// The font set to pick fonts from. Copies share the loader of the font set, so a copy stays
+// usable, on any thread, after the original has moved on to another font set.
 class FlowFontSource {
 public:
     FlowFontSource(wil::com_ptr<IDWriteFactory> dwriteFactory)
@@ -19,12 +38,17 @@ public:
     bool IsUsingSystemFontSet();
 
     wil::com_ptr<IDWriteFontSet> GetDWriteFontSet() const;
+    // Changes whenever the font set is replaced, so objects made from the old one can be dropped.
+    uint32_t Generation() const { return m_generation; }
 
 protected:
     std::wstring GetFamilyName(wil::com_ptr<IDWriteFontSet> fontSet, DWRITE_FONT_PROPERTY_ID prop, UINT32 index);
 
     std::vector<std::wstring> m_currentFilePaths;
-    wil::com_ptr<IDWriteInMemoryFontFileLoader> m_memoryFontLoader;
+    // Set while the font set comes from files; released, rather than unregistered, when the
+    // font set is replaced, since copies may still be using it.
+    std::shared_ptr<const FontLoaderRegistration> m_memoryFontLoader;
     wil::com_ptr<IDWriteFactory> m_dwriteFactory;
     wil::com_ptr<IDWriteFontSet> m_fontSet;
+    uint32_t m_generation = 0;
 };
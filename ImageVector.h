@@ -0,0 +1,46 @@
+#pragma once
+
+// A vector whose elements either belong to it or are borrowed from memory it does not own, such
+// as a mapped document cache image, so that a document can use the image in place. Reading is
+// the same either way. edit() copies borrowed elements into an owned vector first, so changes
+// never reach the borrowed memory, which whoever borrows it keeps alive (see ParsedDocument::storage).
+template<typename T>
+class ImageVector {
+    static_assert(std::is_trivially_copyable<T>::value, "ImageVector only holds trivially copyable types");
+
+public:
+    ImageVector() = default;
+    ImageVector(std::vector<T> owned) : m_owned(std::move(owned)) {}
+
+    // Refers to the count elements at data, which must outlive the vector and its copies.
+    static ImageVector Borrow(const T* data, size_t count) {
+        ImageVector borrowed;
+        borrowed.m_borrowed = data;
+        borrowed.m_borrowedSize = count;
+        return borrowed;
+    }
+
+    const T* data() const { return m_borrowed ? m_borrowed : m_owned.data(); }
+    size_t size() const { return m_borrowed ? m_borrowedSize : m_owned.size(); }
+    bool empty() const { return size() == 0; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size(); }
+    const T& operator[](size_t i) const { return data()[i]; }
+    const T& back() const { return data()[size() - 1]; }
+    bool borrowed() const { return m_borrowed != nullptr; }
+
+    // The elements as an owned vector, which may be changed freely.
+    std::vector<T>& edit() {
+        if (m_borrowed) {
+            m_owned.assign(m_borrowed, m_borrowed + m_borrowedSize);
+            m_borrowed = nullptr;
+            m_borrowedSize = 0;
+        }
+        return m_owned;
+    }
+
+private:
+    std::vector<T> m_owned;
+    const T* m_borrowed = nullptr; // if set, the elements are here rather than in m_owned
+    size_t m_borrowedSize = 0;
+};
@@ -0,0 +1,72 @@
+#include "PortableCommon.h"
+#include "LatestWins.h"
+
+LatestWinsScheduler::LatestWinsScheduler() : m_thread(&LatestWinsScheduler::ThreadMain, this) {}
+
+LatestWinsScheduler::~LatestWinsScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+        m_pending = nullptr;
+        // A sequence number no job has, which cancels the running one.
+        m_latest.fetch_add(1, std::memory_order_release);
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+uint64_t LatestWinsScheduler::Submit(Job job) {
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending) m_stats.superseded++;
+        m_stats.submitted++;
+        m_pending = std::move(job);
+        sequence = m_latest.fetch_add(1, std::memory_order_release) + 1;
+        m_pendingSequence = sequence;
+    }
+    m_wake.notify_one();
+    return sequence;
+}
+
+void LatestWinsScheduler::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] { return !m_pending && !m_running; });
+}
+
+LatestWinsScheduler::Stats LatestWinsScheduler::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void LatestWinsScheduler::ThreadMain() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_wake.wait(lock, [this] { return m_exit || m_pending; });
+        if (m_exit) break;
+        Job job = std::move(m_pending);
+        m_pending = nullptr;
+        CancelToken token(m_latest, m_pendingSequence);
+        m_running = true;
+        lock.unlock();
+
+        bool completed = false;
+        bool failed = false;
+        try {
+            completed = job(token);
+        } catch (...) {
+            failed = true;
+        }
+        // The job may own objects that have to go before the next one starts.
+        job = nullptr;
+
+        lock.lock();
+        m_running = false;
+        if (failed) m_stats.failed++;
+        else if (completed) m_stats.completed++;
+        else m_stats.cancelled++;
+        if (!m_pending) m_idle.notify_all();
+    }
+    m_running = false;
+    m_idle.notify_all();
+}
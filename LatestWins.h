@@ -0,0 +1,98 @@
+#pragma once
+
+// Tells a job of LatestWinsScheduler whether it is still wanted. The job is cancelled as soon as
+// a newer one is submitted or the scheduler shuts down; checking is one atomic load, so a job
+// can check between small steps.
+class CancelToken {
+public:
+	CancelToken(const std::atomic<uint64_t>& latest, uint64_t sequence) : m_latest(latest), m_sequence(sequence) {}
+
+	bool IsCancelled() const { return m_latest.load(std::memory_order_acquire) != m_sequence; }
+	uint64_t Sequence() const { return m_sequence; }
+
+private:
+	const std::atomic<uint64_t>& m_latest;
+	uint64_t m_sequence;
+};
+
+// Runs jobs one at a time on a thread of its own, where only the latest job matters: a job
+// submitted while another waits replaces it, and one submitted while another runs cancels it.
+// Jobs get increasing sequence numbers, so whoever takes their results can drop stale ones.
+class LatestWinsScheduler {
+public:
+	// Returns whether the job ran to the end, rather than stopping early because it was cancelled.
+	using Job = std::function<bool(const CancelToken&)>;
+
+	struct Stats {
+		uint64_t submitted = 0;
+		uint64_t completed = 0;
+		uint64_t cancelled = 0;  // stopped early
+		uint64_t superseded = 0; // replaced before they started
+		uint64_t failed = 0;     // threw an exception
+	};
+
+	LatestWinsScheduler();
+	// Cancels the running job and waits for it; waiting jobs are dropped.
+	~LatestWinsScheduler();
+	LatestWinsScheduler(const LatestWinsScheduler&) = delete;
+	LatestWinsScheduler& operator=(const LatestWinsScheduler&) = delete;
+
+	// Returns the sequence number of the job, greater than that of every job submitted before.
+	uint64_t Submit(Job job);
+	// Whether no job was submitted after the one with this sequence number.
+	bool IsLatest(uint64_t sequence) const { return m_latest.load(std::memory_order_acquire) == sequence; }
+	// Returns once there is neither a running nor a waiting job.
+	void WaitIdle();
+	Stats GetStats() const;
+
+private:
+	void ThreadMain();
+
+	std::atomic<uint64_t> m_latest{ 0 }; // sequence number of the newest job; only changed under m_mutex
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_idle;
+	Job m_pending;
+	uint64_t m_pendingSequence = 0;
+	bool m_running = false;
+	bool m_exit = false;
+	Stats m_stats;
+
+	std::thread m_thread; // last, so that it starts once everything else is set up
+};
+
+// Takes each submitted snapshot through a fixed list of stages on the scheduler thread, and hands
+// the frame built by the stages to deliver, on that thread, unless a newer snapshot came in first.
+// Between stages the job stops if it was cancelled; a stage can also check the token itself.
+template<typename Snapshot, typename Frame>
+class LatestWinsPipeline {
+public:
+	// Returns false if it stopped early because the token was cancelled.
+	using Stage = std::function<bool(const Snapshot&, Frame&, const CancelToken&)>;
+	using Deliver = std::function<void(Frame&& frame, uint64_t sequence)>;
+
+	LatestWinsPipeline(std::vector<Stage> stages, Deliver deliver) : m_stages(std::move(stages)), m_deliver(std::move(deliver)) {}
+
+	uint64_t Submit(Snapshot snapshot) {
+		auto shared = std::make_shared<const Snapshot>(std::move(snapshot));
+		return m_scheduler.Submit([this, shared](const CancelToken& token) {
+			Frame frame{};
+			for (const Stage& stage : m_stages) {
+				if (token.IsCancelled() || !stage(*shared, frame, token)) return false;
+			}
+			if (token.IsCancelled()) return false;
+			m_deliver(std::move(frame), token.Sequence());
+			return true;
+		});
+	}
+
+	bool IsLatest(uint64_t sequence) const { return m_scheduler.IsLatest(sequence); }
+	void WaitIdle() { m_scheduler.WaitIdle(); }
+	LatestWinsScheduler::Stats GetStats() const { return m_scheduler.GetStats(); }
+
+private:
+	std::vector<Stage> m_stages;
+	Deliver m_deliver;
+	LatestWinsScheduler m_scheduler; // last, so that its thread stops before the stages go away
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+// A map bounded by entry count that evicts the least recently used entry when full. Counts
+// hits, misses and evictions so that callers can report how well it works.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+	struct Stats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+	};
+
+	explicit LruCache(size_t capacity) : m_capacity(std::max<size_t>(capacity, 1)) {}
+
+	// The value for key, now the most recently used, or nullptr if there is none.
+	Value* Find(const Key& key) {
+		auto found = m_index.find(key);
+		if (found == m_index.end()) {
+			m_stats.misses++;
+			return nullptr;
+		}
+		m_stats.hits++;
+		m_entries.splice(m_entries.begin(), m_entries, found->second);
+		return &found->second->second;
+	}
+
+	// Adds or replaces the value for key as the most recently used entry.
+	Value& Insert(const Key& key, Value value) {
+		auto found = m_index.find(key);
+		if (found != m_index.end()) {
+			found->second->second = std::move(value);
+			m_entries.splice(m_entries.begin(), m_entries, found->second);
+			return found->second->second;
+		}
+		m_entries.emplace_front(key, std::move(value));
+		m_index.emplace(key, m_entries.begin());
+		Trim();
+		return m_entries.front().second;
+	}
+
+	void Clear() {
+		m_entries.clear();
+		m_index.clear();
+	}
+
+	void SetCapacity(size_t capacity) {
+		m_capacity = std::max<size_t>(capacity, 1);
+		Trim();
+	}
+
+	size_t Size() const { return m_entries.size(); }
+	size_t Capacity() const { return m_capacity; }
+	const Stats& GetStats() const { return m_stats; }
+
+private:
+	using Entry = std::pair<Key, Value>;
+
+	void Trim() {
+		while (m_entries.size() > m_capacity) {
+			m_index.erase(m_entries.back().first);
+			m_entries.pop_back();
+			m_stats.evictions++;
+		}
+	}
+
+	size_t m_capacity;
+	std::list<Entry> m_entries; // most recently used first
+	std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> m_index;
+	Stats m_stats;
+};
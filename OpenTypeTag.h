@@ -0,0 +1,138 @@
+#pragma once
+
+namespace OpenType {
+	// Tags are stored in the byte order DirectWrite uses, see DWRITE_MAKE_OPENTYPE_TAG.
+	constexpr uint32_t MakeTag(char a, char b, char c, char d) {
+		return uint32_t(uint8_t(a)) | (uint32_t(uint8_t(b)) << 8) | (uint32_t(uint8_t(c)) << 16) | (uint32_t(uint8_t(d)) << 24);
+	}
+
+	namespace Literals {
+		// "liga"_tag. Tags shorter than four characters are padded with spaces.
+		constexpr uint32_t operator""_tag(const char* s, size_t n) {
+			return n < 1 || n > 4 ? throw "an OpenType tag has one to four characters"
+				: MakeTag(s[0], n > 1 ? s[1] : ' ', n > 2 ? s[2] : ' ', n > 3 ? s[3] : ' ');
+		}
+	}
+
+	enum TagClass : uint8_t {
+		TagUnregistered = 0,
+		TagFeature = 1, // registered GSUB/GPOS feature
+		TagAxis = 2     // registered variation axis
+	};
+
+	namespace Detail {
+		// Registered features other than cv01-cv99 and ss01-ss20, and registered axes.
+		constexpr char FEATURES[] =
+			"aalt abvf abvm abvs afrc akhn blwf blwm blws c2pc c2sc calt case ccmp cfar chws "
+			"cjct clig cpct cpsp cswh curs dist dlig dnom dtls expt falt fin2 fin3 fina flac "
+			"frac fwid half haln halt hist hkna hlig hngl hojo hwid init isol ital jalt jp78 "
+			"jp83 jp90 jp04 kern lfbd liga ljmo lnum locl ltra ltrm mark med2 medi mgrk mkmk "
+			"mset nalt nlck nukt numr onum opbd ordn ornm palt pcap pkna pnum pref pres pstf "
+			"psts pwid qwid rand rclt rkrf rlig rphf rtbd rtla rtlm ruby rvrn salt sinf size "
+			"smcp smpl ssty stch subs sups swsh titl tjmo tnam tnum trad twid unic valt vatu "
+			"vchw vert vhal vjmo vkna vkrn vpal vrt2 vrtr zero";
+		constexpr char AXES[] = "wght wdth opsz ital slnt";
+
+		constexpr uint32_t BUCKET_BITS = 7;
+		constexpr uint32_t SLOT_BITS = 9;
+		constexpr uint32_t BUCKETS = 1 << BUCKET_BITS;
+		constexpr uint32_t SLOTS = 1 << SLOT_BITS;
+
+		constexpr uint32_t BucketOf(uint32_t tag) {
+			return (tag * 0x9E3779B1u) >> (32 - BUCKET_BITS);
+		}
+		constexpr uint32_t SlotOf(uint32_t tag, uint32_t seed) {
+			uint32_t h = (tag ^ seed) * 0x85EBCA6Bu;
+			return ((h ^ (h >> 15)) * 0xC2B2AE35u) >> (32 - SLOT_BITS);
+		}
+
+		struct Registry {
+			uint32_t seeds[BUCKETS];
+			uint32_t keys[SLOTS]; // 0 for an empty slot, which no tag made of characters matches
+			uint8_t  classes[SLOTS];
+		};
+
+		struct RegistryEntry {
+			uint32_t tag;
+			uint8_t  tagClass;
+		};
+
+		constexpr size_t MAX_ENTRIES = sizeof(FEATURES) / 5 + 99 + 20 + sizeof(AXES) / 5;
+
+		constexpr void AddEntry(RegistryEntry* entries, size_t& count, uint32_t tag, uint8_t tagClass) {
+			for (size_t j = 0; j < count; j++) {
+				if (entries[j].tag == tag) {
+					entries[j].tagClass |= tagClass;
+					return;
+				}
+			}
+			entries[count++] = RegistryEntry{ tag, tagClass };
+		}
+
+		// Hash and displace: the keys of each bucket, largest buckets first, are placed with the
+		// first seed that sends all of them to free slots.
+		constexpr Registry BuildRegistry() {
+			RegistryEntry entries[MAX_ENTRIES] = {};
+			size_t count = 0;
+			for (size_t j = 0; j + 4 < sizeof(FEATURES); j += 5)
+				AddEntry(entries, count, MakeTag(FEATURES[j], FEATURES[j + 1], FEATURES[j + 2], FEATURES[j + 3]), TagFeature);
+			for (char n = 1; n <= 99; n++)
+				AddEntry(entries, count, MakeTag('c', 'v', char('0' + n / 10), char('0' + n % 10)), TagFeature);
+			for (char n = 1; n <= 20; n++)
+				AddEntry(entries, count, MakeTag('s', 's', char('0' + n / 10), char('0' + n % 10)), TagFeature);
+			for (size_t j = 0; j + 4 < sizeof(AXES); j += 5)
+				AddEntry(entries, count, MakeTag(AXES[j], AXES[j + 1], AXES[j + 2], AXES[j + 3]), TagAxis);
+
+			// Group the entries by bucket.
+			size_t bucketBegin[BUCKETS + 1] = {};
+			for (size_t j = 0; j < count; j++) bucketBegin[BucketOf(entries[j].tag) + 1]++;
+			size_t largest = 0;
+			for (uint32_t b = 0; b < BUCKETS; b++) {
+				largest = bucketBegin[b + 1] > largest ? bucketBegin[b + 1] : largest;
+				bucketBegin[b + 1] += bucketBegin[b];
+			}
+			RegistryEntry grouped[MAX_ENTRIES] = {};
+			size_t fill[BUCKETS] = {};
+			for (size_t j = 0; j < count; j++) {
+				uint32_t b = BucketOf(entries[j].tag);
+				grouped[bucketBegin[b] + fill[b]++] = entries[j];
+			}
+
+			Registry r = {};
+			for (size_t size = largest; size > 0; size--) {
+				for (uint32_t b = 0; b < BUCKETS; b++) {
+					if (bucketBegin[b + 1] - bucketBegin[b] != size) continue;
+					for (uint32_t seed = 1;; seed++) {
+						if (seed > 0xFFFF) throw "no perfect hash seed found";
+						bool placed = true;
+						for (size_t j = bucketBegin[b]; placed && j < bucketBegin[b + 1]; j++) {
+							uint32_t slot = SlotOf(grouped[j].tag, seed);
+							if (r.keys[slot]) placed = false;
+							for (size_t k = bucketBegin[b]; k < j; k++) {
+								if (SlotOf(grouped[k].tag, seed) == slot) placed = false;
+							}
+						}
+						if (!placed) continue;
+						for (size_t j = bucketBegin[b]; j < bucketBegin[b + 1]; j++) {
+							uint32_t slot = SlotOf(grouped[j].tag, seed);
+							r.keys[slot] = grouped[j].tag;
+							r.classes[slot] = grouped[j].tagClass;
+						}
+						r.seeds[b] = seed;
+						break;
+					}
+				}
+			}
+			return r;
+		}
+
+		inline constexpr Registry REGISTRY = BuildRegistry();
+	}
+
+	// Classifies a tag against the registered feature and axis lists with two hashes and a
+	// single comparison. The result is a combination of TagClass flags.
+	constexpr uint8_t ClassifyTag(uint32_t tag) {
+		uint32_t slot = Detail::SlotOf(tag, Detail::REGISTRY.seeds[Detail::BucketOf(tag)]);
+		return Detail::REGISTRY.keys[slot] == tag ? Detail::REGISTRY.classes[slot] : uint8_t(TagUnregistered);
+	}
+}
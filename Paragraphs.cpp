@@ -0,0 +1,43 @@
+#include "PortableCommon.h"
+#include "Paragraphs.h"
+#include "DocCache.h"
+
+static uint64_t HashParagraph(const ParsedDocument& doc, const Paragraph& paragraph) {
+    uint64_t h = DocCache::Hash(doc.text.data() + paragraph.cpBegin, (paragraph.cpEnd - paragraph.cpBegin) * sizeof(wchar_t), 0);
+    for (uint32_t i = paragraph.runBegin; i < paragraph.runEnd; i++) {
+        const RunStyle& run = doc.styles[i];
+        uint32_t range[2] = { std::max(run.cpBegin, paragraph.cpBegin) - paragraph.cpBegin, std::min(run.cpEnd, paragraph.cpEnd) - paragraph.cpBegin };
+        StyleSpan style = doc.styleTable.Get(run.style);
+        h = DocCache::Hash(range, sizeof(range), h);
+        h = DocCache::Hash(style.data(), style.size() * sizeof(RunStyleEntry), h);
+    }
+    return h;
+}
+
+std::vector<Paragraph> SplitParagraphs(const ParsedDocument& doc) {
+    const std::wstring_view text = doc.text;
+    const uint32_t length = static_cast<uint32_t>(text.size());
+    std::vector<Paragraph> paragraphs;
+    uint32_t run = 0;
+    auto add = [&](uint32_t cpBegin, uint32_t cpEnd) {
+        // Runs are sorted and disjoint, and so are paragraphs, so one pass finds all overlaps.
+        // A run crossing a separator belongs to the paragraphs on both sides.
+        while (run < doc.styles.size() && doc.styles[run].cpEnd <= cpBegin) run++;
+        uint32_t runEnd = run;
+        while (cpBegin < cpEnd && runEnd < doc.styles.size() && doc.styles[runEnd].cpBegin < cpEnd) runEnd++;
+        Paragraph paragraph{ cpBegin, cpEnd, run, runEnd, 0 };
+        paragraph.hash = HashParagraph(doc, paragraph);
+        paragraphs.push_back(paragraph);
+    };
+
+    uint32_t begin = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        wchar_t ch = text[i];
+        if (ch != L'\n' && ch != L'\r' && ch != 0x85 && ch != 0x2029) continue;
+        add(begin, i);
+        if (ch == L'\r' && i + 1 < length && text[i + 1] == L'\n') i++;
+        begin = i + 1;
+    }
+    add(begin, length);
+    return paragraphs;
+}
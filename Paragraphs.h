@@ -0,0 +1,19 @@
+#pragma once
+#include "DocParser.h"
+
+// A paragraph of a parsed document: its text, without the separator that ends it, and the
+// runs over that text. Paragraphs are laid out independently of each other.
+struct Paragraph {
+	uint32_t cpBegin;
+	uint32_t cpEnd;
+	uint32_t runBegin; // the runs of the document overlapping the text, [runBegin, runEnd)
+	uint32_t runEnd;
+	// Of the text and of the runs clipped to it, with their style entries, relative to cpBegin.
+	// Equal paragraphs have equal hashes wherever they are, in whichever document.
+	uint64_t hash;
+};
+
+// Splits the text at CR, LF, CRLF, NEL and PARAGRAPH SEPARATOR, the characters DirectWrite
+// ends paragraphs at. Text ending in a separator ends with an empty paragraph, as it ends with
+// an empty line in one layout of the whole text; so does empty text.
+std::vector<Paragraph> SplitParagraphs(const ParsedDocument& doc);
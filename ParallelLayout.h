@@ -0,0 +1,54 @@
+#pragma once
+#include "Paragraphs.h"
+#include "ThreadPool.h"
+
+struct ParagraphLayoutStats {
+	size_t paragraphs = 0;
+	size_t distinct = 0; // paragraphs of different hashes
+	size_t reused = 0;   // distinct paragraphs whose layout carried over
+	size_t shaped = 0;   // distinct paragraphs laid out anew
+};
+
+// Brings the layouts of a document's paragraphs up to date and returns them in document
+// order. cache holds the layouts by Paragraph::hash: those of paragraphs that are still there
+// carry over, the others are dropped, and each new distinct paragraph is laid out once by
+// shape, on the pool. Before that, prepare is called for each of them on this thread, for
+// work that is not safe to run concurrently; shape must be. Layout is a handle that is cheap
+// to copy, and the layout shape returns must be complete, so that nothing is left to do for
+// the thread drawing it.
+template<typename Layout, typename Prepare, typename Shape>
+std::vector<Layout> LayOutParagraphs(const std::vector<Paragraph>& paragraphs, std::unordered_map<uint64_t, Layout>& cache,
+	ThreadPool& pool, Prepare prepare, Shape shape, ParagraphLayoutStats* stats = nullptr) {
+	std::unordered_map<uint64_t, Layout> previous = std::move(cache);
+	cache.clear();
+	// Values in an unordered_map stay where they are as it grows, so workers can fill them in.
+	std::vector<std::pair<const Paragraph*, Layout*>> pending;
+	size_t reused = 0;
+	for (const Paragraph& paragraph : paragraphs) {
+		auto slot = cache.try_emplace(paragraph.hash);
+		if (!slot.second) continue;
+		auto found = previous.find(paragraph.hash);
+		if (found != previous.end()) {
+			slot.first->second = std::move(found->second);
+			reused++;
+		} else {
+			pending.emplace_back(&paragraph, &slot.first->second);
+		}
+	}
+
+	for (const auto& item : pending) prepare(*item.first);
+	if (pending.size() > 1) {
+		pool.ParallelFor(pending.size(), 1, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) *pending[i].second = shape(*pending[i].first);
+		});
+	} else if (!pending.empty()) {
+		// Not worth waking the workers for, as when an edit touched one paragraph.
+		*pending[0].second = shape(*pending[0].first);
+	}
+
+	std::vector<Layout> layouts;
+	layouts.reserve(paragraphs.size());
+	for (const Paragraph& paragraph : paragraphs) layouts.push_back(cache.find(paragraph.hash)->second);
+	if (stats) *stats = { paragraphs.size(), cache.size(), reused, pending.size() };
+	return layouts;
+}
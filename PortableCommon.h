@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------
+//
+// Contents:    Shared definitions of the modules that build on any platform.
+//
+// The document parser and its helpers include this instead of Common.h, so they
+// build without Windows headers; see CMakeLists.txt.
+//
+//----------------------------------------------------------------------------
+
+#pragma once
+
+// C headers:
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <memory.h>
+#include <math.h>
+
+// C++ headers:
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <list>
+#include <stack>
+#include <utility>
+#include <limits>
+#include <system_error>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
@@ -0,0 +1,67 @@
+#include "Common.h"
+#include "PreviewRenderer.h"
+#include "TextFile.h"
+
+bool PreviewRenderer::Update(const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token) {
+    // The layout works out what changed since the last snapshot it saw, which need not be the
+    // one submitted before this, since snapshots in between may have been skipped.
+    m_layout.SetFont(*snapshot.fontSource, snapshot.fontSelector);
+    // The layout has let go of what it made from an earlier font set, whose loader may now go.
+    m_fontSource = snapshot.fontSource;
+    if (snapshot.document != m_document) {
+        m_document = snapshot.document;
+        m_text = snapshot.text;
+        m_layout.SetText(m_text, TextFile::ParseCached(m_text, snapshot.fontSelector));
+    } else if (snapshot.text != m_text) {
+        m_text = snapshot.text;
+        m_layout.SetText(m_text);
+    }
+
+    if (!m_renderTarget) {
+        wil::com_ptr<IDWriteGdiInterop> gdiInterop;
+        THROW_IF_FAILED(m_dwriteFactory->GetGdiInterop(&gdiInterop));
+        HDC hdc = GetDC(nullptr);
+        THROW_IF_FAILED(gdiInterop->CreateBitmapRenderTarget(hdc, snapshot.width, snapshot.height, &m_renderTarget));
+        ReleaseDC(nullptr, hdc);
+    } else {
+        SIZE size;
+        THROW_IF_FAILED(m_renderTarget->GetSize(&size));
+        if (UINT32(size.cx) != snapshot.width || UINT32(size.cy) != snapshot.height)
+            THROW_IF_FAILED(m_renderTarget->Resize(snapshot.width, snapshot.height));
+    }
+    float pixelsPerDip = m_renderTarget->GetPixelsPerDip();
+    m_layout.SetSize(float(snapshot.width) / pixelsPerDip, float(snapshot.height) / pixelsPerDip);
+
+    for (const ScrollStep& step : snapshot.scrollSteps) {
+        if (step.number <= m_scrollStep) continue;
+        m_layout.Scroll(step.delta);
+        m_scrollStep = step.number;
+    }
+    frame.scrollStep = m_scrollStep;
+    return true;
+}
+
+bool PreviewRenderer::Draw(const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token) {
+    HDC memoryHdc = m_renderTarget->GetMemoryDC();
+
+    // Clear background.
+    SetDCBrushColor(memoryHdc, snapshot.background);
+    SelectObject(memoryHdc, GetStockObject(NULL_PEN));
+    SelectObject(memoryHdc, GetStockObject(DC_BRUSH));
+    Rectangle(memoryHdc, 0, 0, snapshot.width, snapshot.height);
+
+    // Draw all of the produced glyph runs.
+    m_layout.Render(m_renderTarget, snapshot.renderingParams, snapshot.markings);
+    if (token.IsCancelled()) return false;
+
+    HBITMAP bitmap = (HBITMAP)GetCurrentObject(memoryHdc, OBJ_BITMAP);
+    frame.bitmap.reset((HBITMAP)CopyImage(bitmap, IMAGE_BITMAP, 0, 0, LR_DEFAULTSIZE));
+    return !!frame.bitmap;
+}
+
+std::vector<PreviewRenderer::Pipeline::Stage> PreviewRenderer::Stages() {
+    return {
+        [this](const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token) { return Update(snapshot, frame, token); },
+        [this](const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token) { return Draw(snapshot, frame, token); },
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "FontSource.h"
+#include "FontSelector.h"
+#include "LatestWins.h"
+#include "TextLayout.h"
+
+// One turn of the wheel, in DIPs along the flow direction. Steps are numbered in the order they
+// were taken, across documents.
+struct ScrollStep {
+    uint64_t number = 0;
+    float delta = 0;
+};
+
+// Everything the canvas shows, as of one change in the window. It holds only copies and
+// immutable objects, so the window can keep changing its own state while one is drawn.
+struct PreviewSnapshot {
+    FontSelector fontSelector;
+    std::shared_ptr<const FlowFontSource> fontSource;
+    SharedText text;
+    // Changes when the text is another document rather than an edit of the one before.
+    uint32_t document = 0;
+    // The scroll steps of the document that the renderer may not have applied yet. The layout
+    // stops at either end of the document, so each is applied in turn rather than their sum,
+    // which makes where the view ends up independent of which snapshots were skipped.
+    std::vector<ScrollStep> scrollSteps;
+    UINT32 width = 0; // canvas size in pixels
+    UINT32 height = 0;
+    RenderMarkings markings = RenderMarkings::None;
+    wil::com_ptr<IDWriteRenderingParams> renderingParams;
+    COLORREF background = 0;
+};
+
+struct PreviewFrame {
+    wil::unique_hbitmap bitmap;
+    uint64_t scrollStep = 0; // number of the last scroll step applied
+};
+
+// The layout and render target of the canvas, brought up to each snapshot in turn. Only the
+// pipeline thread uses it; the two steps are the stages of the pipeline.
+class PreviewRenderer {
+public:
+    using Pipeline = LatestWinsPipeline<PreviewSnapshot, PreviewFrame>;
+
+    PreviewRenderer(wil::com_ptr<IDWriteFactory> dwriteFactory)
+        : m_dwriteFactory(dwriteFactory), m_layout(dwriteFactory) {}
+
+    // Applies the font, text, size and scrolling of the snapshot to the layout.
+    bool Update(const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token);
+    // Draws the layout and copies the result into the frame.
+    bool Draw(const PreviewSnapshot& snapshot, PreviewFrame& frame, const CancelToken& token);
+
+    std::vector<Pipeline::Stage> Stages();
+
+private:
+    wil::com_ptr<IDWriteFactory> m_dwriteFactory;
+    wil::com_ptr<IDWriteBitmapRenderTarget> m_renderTarget;
+    TextLayout m_layout;
+    // What of the snapshots the layout has seen already. The font source keeps the fonts of
+    // the layout loadable after its snapshot is gone.
+    std::shared_ptr<const FlowFontSource> m_fontSource;
+    SharedText m_text;
+    uint32_t m_document = 0;
+    uint64_t m_scrollStep = 0;
+};
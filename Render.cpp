@@ -121,6 +121,17 @@ static COLORREF ToCOLORREF(DWRITE_COLOR_F const& color) {
 
 DWRITE_GLYPH_IMAGE_FORMATS g_allMonochromaticOutlineGlyphImageFormats = DWRITE_GLYPH_IMAGE_FORMATS_TRUETYPE | DWRITE_GLYPH_IMAGE_FORMATS_CFF | DWRITE_GLYPH_IMAGE_FORMATS_COLR;
 
+// Whether a glyph run lies outside the band given as the drawing context, if there is one. Only
+// the baseline is known here, so the band is widened by twice the em size to keep the runs whose
+// ascenders or descenders reach into it.
+static bool IsOutsideBand(void* clientDrawingContext, float baselineOriginX, float baselineOriginY, const DWRITE_GLYPH_RUN* glyphRun) {
+	auto band = static_cast<const VisibleBand*>(clientDrawingContext);
+	if (!band) return false;
+	float position = band->vertical ? baselineOriginX : baselineOriginY;
+	float margin = glyphRun->fontEmSize * 2;
+	return position < band->begin - margin || position > band->end + margin;
+}
+
 class BitmapRenderTargetTextRendererBase {
 public:
 	BitmapRenderTargetTextRendererBase(
@@ -317,7 +328,7 @@ public:
 		_In_ DWRITE_GLYPH_RUN_DESCRIPTION const* glyphRunDescription,
 		_In_ IUnknown* clientDrawingEffect
 	) noexcept override {
-		if (glyphRun->glyphCount <= 0)
+		if (glyphRun->glyphCount <= 0 || IsOutsideBand(clientDrawingContext, baselineOriginX, baselineOriginY, glyphRun))
 			return S_OK;
 
 		TransformSetter transformSetter(m_renderTarget, orientationAngle, baselineOriginX, baselineOriginY, 1.0, !!glyphRun->isSideways);
@@ -645,6 +656,9 @@ public:
 		_In_ DWRITE_GLYPH_RUN_DESCRIPTION const* glyphRunDescription,
 		_In_ IUnknown* clientDrawingEffect
 	) noexcept override {
+		if (IsOutsideBand(clientDrawingContext, baselineOriginX, baselineOriginY, glyphRun))
+			return S_OK;
+
 		if (m_renderMarkingsOptions & RenderMarkings::Advance)
 			DrawLayoutBoxes(baselineOriginX, baselineOriginY, orientationAngle, glyphRun);
 
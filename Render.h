@@ -12,6 +12,15 @@ enum RenderMarkings {
 
 ENABLE_BITMASK_OPERATORS(RenderMarkings);
 
+// The visible part of the target along the axis that lines follow each other in: y for
+// horizontal text, x for vertical text. Passed as the drawing context of
+// IDWriteTextLayout::Draw, it makes the renderers skip the glyph runs of lines outside it.
+struct VisibleBand {
+    bool vertical;
+    float begin;
+    float end;
+};
+
 wil::com_ptr<IDWriteTextRenderer1> CreateTextRenderer(
     wil::com_ptr<IDWriteFactory> dwriteFactory,
     wil::com_ptr<IDWriteBitmapRenderTarget> renderTarget,
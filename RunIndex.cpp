@@ -0,0 +1,68 @@
+#include "PortableCommon.h"
+#include "RunIndex.h"
+#include "DocParser.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>
+#define PREFETCH(p) _mm_prefetch(reinterpret_cast<const char*>(p), _MM_HINT_T0)
+#else
+#define PREFETCH(p) ((void)(p))
+#endif
+
+RunIndex::RunIndex(const ImageVector<RunStyle>& runs) {
+    std::vector<Node> tree(runs.size() + 1);
+    Fill(tree, runs, 0, 1);
+    m_tree = std::move(tree);
+}
+
+RunIndex RunIndex::Borrow(const Node* nodes, size_t count) {
+    RunIndex index;
+    index.m_tree = ImageVector<Node>::Borrow(nodes, count);
+    return index;
+}
+
+// An in-order walk of the tree visits the nodes in sorted order.
+size_t RunIndex::Fill(std::vector<Node>& tree, const ImageVector<RunStyle>& runs, size_t next, size_t k) {
+    if (k >= tree.size()) return next;
+    next = Fill(tree, runs, next, 2 * k);
+    tree[k] = Node{ runs[next].cpBegin, runs[next].cpEnd, static_cast<uint32_t>(next) };
+    return Fill(tree, runs, next + 1, 2 * k + 1);
+}
+
+size_t RunIndex::CountStartingBefore(uint32_t cp, uint32_t& cpEnd) const {
+    // Tracks the last node found so far that starts at or before cp. The updates are masked
+    // rather than conditional, since the direction taken at each level is unpredictable.
+    // The 16 descendants four levels down are fetched ahead while this level is compared.
+    const Node* tree = m_tree.data();
+    const size_t size = m_tree.size();
+    size_t count = 0;
+    uint32_t end = 0;
+    size_t k = 1;
+    while (k < size) {
+        PREFETCH(tree + std::min(16 * k, size - 1));
+        PREFETCH(tree + std::min(16 * k + 15, size - 1));
+        const Node& node = tree[k];
+        size_t right = node.cpBegin <= cp;
+        size_t take = 0 - right; // all ones when going right
+        count ^= (count ^ (node.run + size_t(1))) & take;
+        end ^= (end ^ node.cpEnd) & static_cast<uint32_t>(take);
+        k = 2 * k + right;
+    }
+    cpEnd = end;
+    return count;
+}
+
+size_t RunIndex::Find(uint32_t cp) const {
+    uint32_t cpEnd;
+    size_t count = CountStartingBefore(cp, cpEnd);
+    if (count == 0 || cpEnd <= cp) return NO_RUN;
+    return count - 1;
+}
+
+std::pair<size_t, size_t> RunIndex::FindRange(uint32_t cpBegin, uint32_t cpEnd) const {
+    uint32_t end;
+    size_t first = CountStartingBefore(cpBegin, end);
+    if (first > 0 && end > cpBegin) first--;
+    size_t last = cpEnd > cpBegin ? CountStartingBefore(cpEnd - 1, end) : first;
+    return { first, std::max(first, last) };
+}
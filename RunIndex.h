@@ -0,0 +1,39 @@
+#pragma once
+#include "ImageVector.h"
+
+struct RunStyle;
+
+// Immutable search index over the runs of a parsed document, which are disjoint and sorted.
+// The run starts are kept in Eytzinger order (an implicit binary tree where the children of
+// node k are 2k and 2k + 1), so a query walks the tree top-down with one predictable memory
+// access per level and never allocates. The tree can be stored as is, and used in place.
+class RunIndex {
+public:
+	static constexpr size_t NO_RUN = SIZE_MAX;
+
+	struct Node {
+		uint32_t cpBegin;
+		uint32_t cpEnd;
+		uint32_t run; // index of the run in the document
+	};
+
+	RunIndex() = default;
+	explicit RunIndex(const ImageVector<RunStyle>& runs);
+	// An index over a tree stored from Nodes, which must outlive the index.
+	static RunIndex Borrow(const Node* nodes, size_t count);
+
+	// Index of the run containing cp, or NO_RUN.
+	size_t Find(uint32_t cp) const;
+	// Index range [first, last) of the runs overlapping [cpBegin, cpEnd).
+	std::pair<size_t, size_t> FindRange(uint32_t cpBegin, uint32_t cpEnd) const;
+	size_t Size() const { return m_tree.empty() ? 0 : m_tree.size() - 1; }
+	// The tree, 1-based, or empty if the index is.
+	const ImageVector<Node>& Nodes() const { return m_tree; }
+
+private:
+	size_t Fill(std::vector<Node>& tree, const ImageVector<RunStyle>& runs, size_t next, size_t k);
+	// Number of runs starting at or before cp; cpEnd receives the end of the last of them.
+	size_t CountStartingBefore(uint32_t cp, uint32_t& cpEnd) const;
+
+	ImageVector<Node> m_tree; // 1-based; m_tree[0] is unused
+};
@@ -0,0 +1,265 @@
+#include "PortableCommon.h"
+#include "Segmentation.h"
+#include "BitScan.h"
+#include "SegmentationTables.h"
+
+using namespace Segmentation;
+
+size_t BoundaryBitmap::Next(size_t i) const {
+    for (size_t word = (i + 1) >> 6; word < m_bits.size(); word++) {
+        uint64_t bits = m_bits[word];
+        if (word == (i + 1) >> 6) bits &= ~uint64_t(0) << ((i + 1) & 63);
+        if (bits) return std::min(word * 64 + BitScan::Lowest64(bits), m_size);
+    }
+    return m_size;
+}
+
+template<typename T1, typename T2, typename T3, size_t N>
+static inline uint32_t Lookup(const T1& stage1, const T2& stage2, const T3 (&stage3)[N], uint32_t cp) {
+    if (cp >= 0x110000) return 0;
+    uint32_t row = stage1[cp >> TABLE_SHIFT1];
+    uint32_t block = stage2[(row << (TABLE_SHIFT1 - TABLE_SHIFT2)) | ((cp >> TABLE_SHIFT2) & ((1 << (TABLE_SHIFT1 - TABLE_SHIFT2)) - 1))];
+    return stage3[(block << TABLE_SHIFT2) | (cp & ((1 << TABLE_SHIFT2) - 1))];
+}
+
+static inline uint16_t BreakPropsOf(uint32_t cp) {
+    return BREAK_PROPS[Lookup(BREAK_STAGE1, BREAK_STAGE2, BREAK_STAGE3, cp)];
+}
+
+ScriptId Segmentation::ScriptOf(uint32_t codePoint) {
+    return static_cast<ScriptId>(Lookup(SCRIPT_STAGE1, SCRIPT_STAGE2, SCRIPT_STAGE3, codePoint));
+}
+
+// ASCII dominates most sample texts, so its properties skip the staged lookups.
+struct AsciiProps {
+    uint16_t props[128];
+    ScriptId scripts[128];
+    AsciiProps() {
+        for (uint32_t cp = 0; cp < 128; cp++) {
+            props[cp] = BreakPropsOf(cp);
+            scripts[cp] = ScriptOf(cp);
+        }
+    }
+};
+static const AsciiProps ASCII_PROPS;
+
+const char* Segmentation::ScriptName(ScriptId script) {
+    return script < sizeof(SCRIPT_NAMES) / sizeof(SCRIPT_NAMES[0]) ? SCRIPT_NAMES[script] : SCRIPT_NAMES[SCRIPT_UNKNOWN];
+}
+
+static inline GraphemeBreak GraphemeOf(uint16_t props) { return static_cast<GraphemeBreak>(props & 15); }
+static inline WordBreak WordOf(uint16_t props) { return static_cast<WordBreak>((props >> 4) & 31); }
+static inline bool IsPictographic(uint16_t props) { return (props >> 9) & 1; }
+static inline IndicConjunctBreak ConjunctOf(uint16_t props) { return static_cast<IndicConjunctBreak>((props >> 10) & 3); }
+
+// Lone surrogates are controls for grapheme clusters and plain characters for words.
+static const uint16_t LONE_SURROGATE_PROPS = GB_Control | WB_Other << 4;
+
+static_assert(sizeof(SCRIPT_NAMES) / sizeof(SCRIPT_NAMES[0]) <= 256, "scripts fit a ScriptId");
+
+void TextSegmenter::Add(const wchar_t* text, size_t length) {
+    // Boundaries are set at positions before m_length, so the bitmaps only grow here.
+    size_t size = m_result.graphemes.Size();
+    if (size < m_length + length) {
+        size = std::max(m_length + length, size * 2);
+        m_result.graphemes.Resize(size);
+        m_result.words.Resize(size);
+        m_result.scripts.Resize(size);
+    }
+    for (size_t i = 0; i < length; i++) {
+        uint32_t unit = static_cast<uint32_t>(text[i]);
+        size_t pos = m_length++;
+        if (m_highSurrogate) {
+            uint32_t high = m_highSurrogate;
+            m_highSurrogate = 0;
+            if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                AddCodePoint(0x10000 + ((high - 0xD800) << 10) + (unit - 0xDC00), pos - 1);
+                continue;
+            }
+            AddCodePoint(high, pos - 1);
+        }
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            m_highSurrogate = static_cast<wchar_t>(unit);
+        } else {
+            AddCodePoint(unit, pos);
+        }
+    }
+}
+
+void TextSegmenter::AddCodePoint(uint32_t cp, size_t pos) {
+    uint16_t props;
+    ScriptId script;
+    if (cp < 128) {
+        props = ASCII_PROPS.props[cp];
+        script = ASCII_PROPS.scripts[cp];
+    } else {
+        props = cp >= 0xD800 && cp <= 0xDFFF ? LONE_SURROGATE_PROPS : BreakPropsOf(cp);
+        script = ScriptOf(cp);
+    }
+    bool grapheme = GraphemeBoundary(props, pos);
+    if (grapheme) m_result.graphemes.Set(pos);
+    if (WordBoundary(props, pos)) m_result.words.Set(pos);
+
+    if (pos == 0) {
+        m_result.scripts.Set(pos);
+    }
+    if (script > SCRIPT_INHERITED && script != m_script && grapheme) {
+        // The run so far only held Common and Inherited characters, which take this script.
+        if (m_script > SCRIPT_INHERITED) m_result.scripts.Set(pos);
+        m_script = script;
+    }
+}
+
+// The grapheme rules that only look at the two characters around the boundary, as a table.
+// Pairs that also depend on the characters before are left to GraphemeBoundary.
+enum PairRule : uint8_t { PairJoin, PairBreak, PairDepends };
+
+static constexpr PairRule GraphemePairRule(GraphemeBreak prev, GraphemeBreak next) {
+    if (prev == GB_CR && next == GB_LF) return PairJoin;                                                  // GB3
+    if (prev == GB_Control || prev == GB_CR || prev == GB_LF) return PairBreak;                           // GB4
+    if (next == GB_Control || next == GB_CR || next == GB_LF) return PairBreak;                           // GB5
+    if (prev == GB_L && (next == GB_L || next == GB_V || next == GB_LV || next == GB_LVT)) return PairJoin; // GB6
+    if ((prev == GB_LV || prev == GB_V) && (next == GB_V || next == GB_T)) return PairJoin;               // GB7
+    if ((prev == GB_LVT || prev == GB_T) && next == GB_T) return PairJoin;                                // GB8
+    if (next == GB_Extend || next == GB_ZWJ || next == GB_SpacingMark || prev == GB_Prepend) return PairJoin; // GB9, GB9a, GB9b
+    // Conjunct consonants and pictographs are Other; they follow a linker or a ZWJ, both of
+    // which may come after Extend characters.
+    if ((prev == GB_Extend || prev == GB_ZWJ) && next == GB_Other) return PairDepends;                   // GB9c, GB11
+    if (prev == GB_Regional_Indicator && next == GB_Regional_Indicator) return PairDepends;               // GB12, GB13
+    return PairBreak;                                                                                     // GB999
+}
+
+struct GraphemePairs {
+    PairRule rules[16][16];
+    constexpr GraphemePairs() : rules() {
+        for (int prev = 0; prev < 16; prev++) {
+            for (int next = 0; next < 16; next++)
+                rules[prev][next] = GraphemePairRule(static_cast<GraphemeBreak>(prev), static_cast<GraphemeBreak>(next));
+        }
+    }
+};
+static constexpr GraphemePairs GRAPHEME_PAIRS;
+
+bool TextSegmenter::GraphemeBoundary(uint16_t props, size_t pos) {
+    GraphemeBreak prev = static_cast<GraphemeBreak>(m_graphemePrev), next = GraphemeOf(props);
+    bool boundary;
+    switch (GRAPHEME_PAIRS.rules[prev][next]) {
+    case PairJoin:
+        boundary = false;
+        break;
+    case PairBreak:
+        boundary = true;
+        break;
+    default:
+        if (next == GB_Regional_Indicator) {
+            boundary = m_graphemeRegional % 2 == 0;                                              // GB12, GB13
+        } else {
+            boundary = !(m_conjunct == 2 && ConjunctOf(props) == ICB_Consonant)                  // GB9c
+                && !(m_emoji == 2 && IsPictographic(props));                                     // GB11
+        }
+        break;
+    }
+    if (pos == 0) boundary = true;                                                               // GB1
+
+    m_graphemePrev = next;
+    m_graphemeRegional = next == GB_Regional_Indicator ? m_graphemeRegional + 1 : 0;
+    if (IsPictographic(props)) {
+        m_emoji = 1;
+    } else if (m_emoji == 1 && next == GB_ZWJ) {
+        m_emoji = 2;
+    } else if (m_emoji != 1 || next != GB_Extend) {
+        m_emoji = 0;
+    }
+    IndicConjunctBreak conjunct = ConjunctOf(props);
+    if (conjunct == ICB_Consonant) {
+        m_conjunct = 1;
+    } else if (m_conjunct && conjunct == ICB_Linker) {
+        m_conjunct = 2;
+    } else if (conjunct != ICB_Extend) {
+        m_conjunct = 0;
+    }
+    return boundary;
+}
+
+static inline bool IsAHLetter(WordBreak wb) { return wb == WB_ALetter || wb == WB_Hebrew_Letter; }
+static inline bool IsMidLetterQ(WordBreak wb) { return wb == WB_MidLetter || wb == WB_MidNumLet || wb == WB_Single_Quote; }
+static inline bool IsMidNumQ(WordBreak wb) { return wb == WB_MidNum || wb == WB_MidNumLet || wb == WB_Single_Quote; }
+static inline bool IsNewline(WordBreak wb) { return wb == WB_Newline || wb == WB_CR || wb == WB_LF; }
+
+// What a pending middle character needs next to stay within the word.
+enum PendingNeeds : uint8_t {
+    NeedsNothing,
+    NeedsAHLetter,     // WB6 and WB7
+    NeedsHebrewLetter, // WB7b and WB7c
+    NeedsNumeric       // WB11 and WB12
+};
+
+static bool Satisfies(PendingNeeds needs, WordBreak wb) {
+    switch (needs) {
+    case NeedsAHLetter: return IsAHLetter(wb);
+    case NeedsHebrewLetter: return wb == WB_Hebrew_Letter;
+    case NeedsNumeric: return wb == WB_Numeric;
+    default: return false;
+    }
+}
+
+bool TextSegmenter::WordBoundary(uint16_t props, size_t pos) {
+    WordBreak raw = static_cast<WordBreak>(m_wordRaw), a = static_cast<WordBreak>(m_wordPrev);
+    WordBreak aa = static_cast<WordBreak>(m_wordPrevPrev), b = WordOf(props);
+    m_wordRaw = b;
+
+    // WB4: after anything but the start and line breaks, Extend, Format and ZWJ join the
+    // character before them and are otherwise ignored.
+    bool transparent = (b == WB_Extend || b == WB_Format || b == WB_ZWJ) && pos > 0 && !IsNewline(a);
+    if (transparent) return false;
+
+    // The character decides the boundary before a pending middle character.
+    if (m_pendingPos != SIZE_MAX) {
+        if (!Satisfies(static_cast<PendingNeeds>(m_pendingNeeds), b)) m_result.words.Set(m_pendingPos);
+        m_pendingPos = SIZE_MAX;
+    }
+    uint32_t regional = m_wordRegional;
+    m_wordPrevPrev = a;
+    m_wordPrev = b;
+    m_wordRegional = b == WB_Regional_Indicator ? regional + 1 : 0;
+
+    auto pending = [this, pos](PendingNeeds needs) {
+        m_pendingPos = pos;
+        m_pendingNeeds = needs;
+        return false;
+    };
+    if (pos == 0) return true;                                                          // WB1
+    if (raw == WB_CR && b == WB_LF) return false;                                       // WB3
+    if (IsNewline(raw) || IsNewline(b)) return true;                                    // WB3a, WB3b
+    if (raw == WB_ZWJ && IsPictographic(props)) return false;                           // WB3c
+    if (raw == WB_WSegSpace && b == WB_WSegSpace) return false;                         // WB3d
+    if (IsAHLetter(a) && IsAHLetter(b)) return false;                                   // WB5
+    if (a == WB_Hebrew_Letter && b == WB_Single_Quote) return false;                    // WB7a
+    if (IsAHLetter(a) && IsMidLetterQ(b)) return pending(NeedsAHLetter);                // WB6
+    if (IsAHLetter(aa) && IsMidLetterQ(a) && IsAHLetter(b)) return false;               // WB7
+    if (a == WB_Hebrew_Letter && b == WB_Double_Quote) return pending(NeedsHebrewLetter); // WB7b
+    if (aa == WB_Hebrew_Letter && a == WB_Double_Quote && b == WB_Hebrew_Letter) return false; // WB7c
+    if ((a == WB_Numeric || IsAHLetter(a)) && (b == WB_Numeric || IsAHLetter(b))) return false; // WB8, WB9, WB10
+    if (aa == WB_Numeric && IsMidNumQ(a) && b == WB_Numeric) return false;              // WB11
+    if (a == WB_Numeric && IsMidNumQ(b)) return pending(NeedsNumeric);                  // WB12
+    if (a == WB_Katakana && b == WB_Katakana) return false;                             // WB13
+    if ((IsAHLetter(a) || a == WB_Numeric || a == WB_Katakana || a == WB_ExtendNumLet) && b == WB_ExtendNumLet)
+        return false;                                                                   // WB13a
+    if (a == WB_ExtendNumLet && (IsAHLetter(b) || b == WB_Numeric || b == WB_Katakana)) return false; // WB13b
+    if (a == WB_Regional_Indicator && b == WB_Regional_Indicator) return regional % 2 == 0; // WB15, WB16
+    return true;                                                                        // WB999
+}
+
+void TextSegmenter::Finish(TextSegmentation& result) {
+    if (m_highSurrogate) {
+        wchar_t high = m_highSurrogate;
+        m_highSurrogate = 0;
+        AddCodePoint(high, m_length - 1);
+    }
+    if (m_pendingPos != SIZE_MAX) m_result.words.Set(m_pendingPos);
+    m_result.graphemes.Resize(m_length);
+    m_result.words.Resize(m_length);
+    m_result.scripts.Resize(m_length);
+    result = std::move(m_result);
+    *this = TextSegmenter();
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+// One bit per UTF-16 code unit of a text, set where a segment starts. The first code unit
+// of a non-empty text always starts one.
+class BoundaryBitmap {
+public:
+	bool Test(size_t i) const { return (m_bits[i >> 6] >> (i & 63)) & 1; }
+	void Set(size_t i) { m_bits[i >> 6] |= uint64_t(1) << (i & 63); }
+	void Resize(size_t size) { m_bits.resize((size + 63) >> 6); m_size = size; }
+	size_t Size() const { return m_size; }
+	// The first boundary after code unit i, or Size() if there is none.
+	size_t Next(size_t i) const;
+
+private:
+	std::vector<uint64_t> m_bits;
+	size_t m_size = 0;
+};
+
+// Boundaries of a text after UAX #29 (extended grapheme clusters and words) and of its
+// script runs after UAX #24. Characters of the Common and Inherited scripts join the run
+// around them, and a run only starts at a grapheme cluster boundary.
+struct TextSegmentation {
+	BoundaryBitmap graphemes;
+	BoundaryBitmap words;
+	BoundaryBitmap scripts;
+};
+
+namespace Segmentation {
+	using ScriptId = uint8_t;
+	constexpr ScriptId SCRIPT_UNKNOWN = 0;
+	constexpr ScriptId SCRIPT_COMMON = 1;
+	constexpr ScriptId SCRIPT_INHERITED = 2;
+
+	ScriptId ScriptOf(uint32_t codePoint);
+	// The Unicode name of the script, e.g. "Latin".
+	const char* ScriptName(ScriptId script);
+}
+
+// Segments a text that arrives in pieces, deciding each boundary as soon as the text after it
+// allows. A surrogate pair may be split across pieces.
+class TextSegmenter {
+public:
+	void Add(const wchar_t* text, size_t length);
+	void Add(wchar_t wch) { Add(&wch, 1); }
+	// Ends the text and moves the boundaries out; the segmenter starts over afterwards.
+	void Finish(TextSegmentation& result);
+
+private:
+	void AddCodePoint(uint32_t codePoint, size_t pos);
+	bool GraphemeBoundary(uint16_t props, size_t pos);
+	bool WordBoundary(uint16_t props, size_t pos);
+
+	TextSegmentation m_result;
+	size_t m_length = 0;          // code units added
+	wchar_t m_highSurrogate = 0;  // awaiting its low surrogate
+
+	// Grapheme clusters
+	uint8_t m_graphemePrev = 0;
+	uint32_t m_graphemeRegional = 0; // regional indicators directly before
+	uint8_t m_emoji = 0;             // 1 after ExtPict Extend*, 2 after ExtPict Extend* ZWJ
+	uint8_t m_conjunct = 0;          // 1 after InCB Consonant [Extend Linker]*, 2 if a Linker was among them
+
+	// Words, where rule WB4 makes Extend, Format and ZWJ transparent
+	uint8_t m_wordRaw = 0;           // the previous character
+	uint8_t m_wordPrev = 0;          // the previous character that is not transparent
+	uint8_t m_wordPrevPrev = 0;      // and the one before it
+	uint32_t m_wordRegional = 0;
+	bool m_wordStarted = false;
+	size_t m_pendingPos = SIZE_MAX;  // a middle character whose boundary depends on the next one
+	uint8_t m_pendingNeeds = 0;      // the word break of the next character that removes it
+
+	// Script runs
+	Segmentation::ScriptId m_script = Segmentation::SCRIPT_COMMON;
+};
@@ -0,0 +1,1352 @@
+#pragma once
+
+// Generated by unicode/GenSegmentationTables.py from the Unicode 16.0.0 Character Database.
+// Do not edit.
+
+namespace Segmentation {
+	enum GraphemeBreak : uint8_t {
+		GB_Other,
+		GB_CR,
+		GB_LF,
+		GB_Control,
+		GB_Extend,
+		GB_ZWJ,
+		GB_Regional_Indicator,
+		GB_Prepend,
+		GB_SpacingMark,
+		GB_L,
+		GB_V,
+		GB_T,
+		GB_LV,
+		GB_LVT,
+	};
+	enum WordBreak : uint8_t {
+		WB_Other,
+		WB_CR,
+		WB_LF,
+		WB_Newline,
+		WB_Extend,
+		WB_ZWJ,
+		WB_Regional_Indicator,
+		WB_Format,
+		WB_Katakana,
+		WB_Hebrew_Letter,
+		WB_ALetter,
+		WB_Single_Quote,
+		WB_Double_Quote,
+		WB_MidNumLet,
+		WB_MidLetter,
+		WB_MidNum,
+		WB_Numeric,
+		WB_ExtendNumLet,
+		WB_WSegSpace,
+	};
+	enum IndicConjunctBreak : uint8_t {
+		ICB_None,
+		ICB_Consonant,
+		ICB_Extend,
+		ICB_Linker,
+	};
+
+	constexpr uint32_t TABLE_SHIFT1 = 9;
+	constexpr uint32_t TABLE_SHIFT2 = 4;
+
+	// GraphemeBreak | WordBreak << 4 | Extended_Pictographic << 9 | IndicConjunctBreak << 10
+	constexpr uint16_t BREAK_PROPS[] = {
+		3, 34, 51, 17, 288, 0, 192, 176, 240, 208, 256, 224,
+		160, 272, 512, 115, 2116, 144, 263, 167, 72, 1184, 3140, 8,
+		64, 169, 170, 171, 68, 2133, 672, 128, 172, 173, 102,
+	};
+	constexpr uint8_t BREAK_STAGE1[] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+		24, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34,
+		35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+		27, 59, 60, 26, 26, 26, 26, 61, 27, 27, 62, 27, 27, 27, 27, 27, 27, 63, 27, 64, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 65, 26, 26, 26, 27, 66, 67, 68, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 69,
+		70, 26, 26, 26, 26, 26, 71, 26, 26, 26, 26, 26, 26, 26, 72, 73, 74, 75, 76, 77, 26, 78, 26, 79,
+		80, 81, 82, 83, 84, 26, 26, 85, 86, 87, 88, 89, 90, 91, 92, 93, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 94, 95, 95, 95, 95, 95, 95, 95,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	};
+	constexpr uint16_t BREAK_STAGE2[] = {
+		0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 10, 10,
+		13, 13, 13, 13, 13, 13, 13, 14, 15, 10, 16, 10, 10, 10, 10, 17, 10, 10, 10, 10, 10, 10, 10, 10,
+		18, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10, 19, 10, 10, 20, 21, 13, 22, 23, 24, 25, 26,
+		27, 28, 10, 10, 29, 13, 30, 31, 10, 10, 10, 10, 10, 32, 33, 34, 35, 36, 10, 13, 37, 10, 10, 10,
+		10, 10, 38, 39, 40, 10, 29, 41, 10, 42, 43, 44, 10, 45, 46, 10, 47, 48, 10, 10, 49, 13, 50, 13,
+		51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 57, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+		74, 75, 61, 76, 77, 78, 57, 79, 80, 60, 61, 81, 82, 83, 57, 84, 85, 86, 87, 88, 89, 90, 72, 44,
+		91, 92, 61, 93, 94, 95, 57, 44, 96, 97, 68, 98, 99, 100, 57, 101, 102, 92, 53, 103, 104, 105, 57, 106,
+		107, 108, 10, 109, 110, 111, 72, 112, 44, 44, 44, 113, 114, 115, 44, 44, 44, 44, 44, 116, 117, 115, 44, 44,
+		78, 118, 115, 119, 120, 10, 121, 122, 123, 124, 13, 125, 126, 44, 44, 44, 44, 44, 127, 128, 115, 129, 130, 131,
+		132, 133, 10, 10, 134, 10, 10, 135, 136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 138, 139, 139, 139, 139, 139,
+		10, 10, 10, 10, 140, 141, 10, 10, 140, 10, 10, 142, 143, 11, 10, 10, 10, 143, 10, 10, 10, 144, 44, 44,
+		10, 44, 10, 10, 10, 10, 10, 145, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 146, 10,
+		147, 46, 10, 10, 10, 10, 148, 149, 10, 150, 10, 151, 10, 152, 153, 154, 44, 44, 44, 155, 156, 157, 115, 44,
+		158, 115, 10, 10, 10, 10, 10, 149, 159, 10, 160, 10, 10, 10, 10, 161, 10, 162, 163, 164, 72, 44, 44, 44,
+		44, 44, 44, 44, 44, 165, 44, 44, 10, 166, 44, 44, 44, 167, 168, 169, 115, 115, 44, 13, 170, 44, 44, 44,
+		171, 10, 10, 172, 173, 115, 174, 175, 176, 10, 177, 40, 10, 10, 178, 175, 10, 10, 179, 180, 181, 40, 10, 182,
+		46, 10, 10, 183, 44, 184, 185, 186, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 145, 10, 10, 145, 187, 10, 182,
+		10, 10, 10, 188, 189, 190, 121, 189, 191, 192, 193, 194, 195, 196, 197, 198, 44, 121, 44, 44, 44, 13, 13, 199,
+		200, 201, 202, 203, 204, 44, 10, 10, 149, 205, 206, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 207, 208, 44, 44, 44, 44, 44, 208, 44, 44, 44, 209, 44, 210, 211,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 212, 213, 10, 214, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 207, 215, 216, 44, 44, 217, 218, 219, 220, 220, 220, 220, 220, 220, 221, 220, 220, 220, 220, 220, 220, 220,
+		222, 223, 224, 225, 226, 227, 228, 44, 44, 229, 230, 231, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 232, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 229, 233, 44, 44, 44, 234, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 235, 236,
+		10, 10, 134, 10, 10, 10, 237, 238, 10, 239, 240, 240, 240, 240, 13, 13, 44, 44, 241, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		242, 44, 243, 244, 44, 44, 44, 44, 44, 245, 246, 246, 246, 246, 246, 247, 248, 10, 10, 4, 10, 10, 10, 10,
+		162, 44, 10, 10, 44, 44, 44, 246, 44, 44, 44, 44, 44, 44, 44, 44, 44, 249, 44, 44, 44, 246, 246, 250,
+		246, 246, 246, 246, 246, 251, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 121, 44, 44, 44, 44, 10, 10, 182,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 121, 10, 252, 44, 10, 10, 253, 254,
+		10, 255, 10, 10, 10, 10, 10, 256, 257, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 182, 258, 44, 259,
+		260, 10, 261, 44, 10, 10, 10, 262, 263, 10, 10, 264, 265, 115, 13, 266, 40, 10, 267, 10, 268, 269, 136, 270,
+		51, 10, 10, 271, 272, 115, 273, 115, 10, 10, 274, 275, 276, 115, 44, 277, 44, 44, 44, 278, 279, 44, 280, 281,
+		282, 283, 240, 10, 10, 10, 214, 10, 10, 10, 10, 10, 10, 10, 284, 115, 285, 286, 287, 288, 287, 289, 287, 285,
+		286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288,
+		287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287,
+		285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287,
+		288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289,
+		287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286,
+		287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287,
+		289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285,
+		286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288,
+		287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287,
+		285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287, 288, 287, 289, 287, 285, 286, 287,
+		288, 287, 290, 137, 291, 139, 139, 292, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		239, 293, 294, 295, 296, 10, 10, 10, 10, 10, 10, 297, 44, 298, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 182, 44, 10, 10, 10, 10, 259, 10, 10, 299, 44, 44, 300,
+		13, 301, 13, 302, 303, 304, 44, 305, 10, 10, 10, 10, 10, 10, 10, 306, 307, 3, 4, 5, 4, 46, 308, 246,
+		246, 309, 10, 162, 310, 311, 44, 312, 313, 10, 11, 314, 182, 182, 44, 44, 10, 10, 10, 10, 10, 10, 10, 46,
+		44, 44, 44, 44, 10, 10, 10, 315, 44, 44, 44, 44, 44, 44, 44, 316, 44, 44, 44, 44, 44, 44, 44, 44,
+		10, 121, 10, 10, 10, 78, 199, 44, 10, 10, 317, 10, 46, 10, 10, 318, 10, 182, 10, 10, 319, 320, 44, 44,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 182, 115, 10, 10, 319, 10, 300, 10, 10, 299, 10, 10, 10, 262, 135,
+		135, 321, 16, 322, 10, 10, 10, 262, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 239, 10, 161, 299, 44, 17, 10, 10, 323, 44, 44, 44, 44, 324, 10, 10, 325, 10, 161, 10, 239,
+		10, 162, 44, 44, 44, 44, 10, 326, 10, 161, 10, 214, 44, 44, 44, 44, 10, 10, 10, 12, 44, 44, 44, 44,
+		327, 328, 10, 329, 44, 44, 10, 121, 10, 121, 44, 44, 120, 10, 330, 44, 10, 10, 10, 161, 10, 161, 10, 331,
+		10, 297, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 149, 44, 44, 44, 10, 10, 10, 331, 10, 10, 10, 331,
+		10, 10, 332, 115, 40, 10, 333, 10, 161, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		10, 10, 334, 297, 335, 44, 44, 336, 10, 121, 337, 10, 38, 199, 44, 10, 338, 44, 44, 10, 315, 44, 10, 239,
+		339, 10, 10, 340, 341, 44, 72, 342, 176, 10, 10, 343, 344, 10, 149, 115, 345, 10, 346, 347, 348, 10, 10, 349,
+		176, 10, 10, 350, 351, 352, 44, 44, 10, 16, 353, 354, 355, 44, 44, 44, 356, 357, 149, 10, 10, 253, 358, 115,
+		359, 67, 68, 360, 361, 362, 363, 364, 365, 10, 10, 366, 367, 368, 369, 44, 10, 10, 10, 370, 371, 372, 297, 44,
+		10, 10, 10, 373, 374, 115, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 253, 375, 199, 376, 44, 44,
+		10, 10, 10, 377, 378, 115, 44, 44, 10, 10, 379, 380, 115, 381, 382, 44, 44, 383, 384, 115, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 353, 385, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 115, 241,
+		386, 387, 10, 388, 389, 115, 44, 44, 44, 44, 390, 10, 10, 391, 392, 44, 393, 10, 10, 394, 395, 396, 10, 10,
+		397, 398, 44, 10, 10, 10, 10, 149, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 78, 115,
+		68, 10, 399, 400, 78, 115, 44, 259, 10, 401, 402, 403, 44, 44, 44, 44, 404, 10, 10, 405, 406, 115, 407, 10,
+		408, 409, 115, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 410,
+		411, 97, 10, 412, 413, 414, 44, 44, 44, 44, 44, 78, 44, 44, 44, 44, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 214, 44, 44, 44, 44, 44, 44,
+		10, 10, 10, 10, 10, 10, 162, 44, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 262, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 10, 10, 78, 10, 10, 10, 415, 416, 417, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 46, 10, 10, 10, 10, 239, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 10, 255, 418, 115, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		10, 10, 10, 149, 10, 162, 115, 10, 10, 10, 10, 162, 115, 10, 182, 364, 10, 10, 10, 341, 262, 115, 298, 419,
+		10, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 10, 10, 420, 115, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10,
+		44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 421, 422, 423, 423, 424, 345, 44, 44, 44, 44, 425, 256,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 426, 427, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 428, 44, 44, 429, 430, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 10, 10, 46, 121,
+		149, 431, 432, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 115, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		13, 13, 433, 13, 341, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 434, 435, 436, 44, 437, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 438, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 10, 10, 10, 10, 10, 305, 10, 10, 10, 153, 439, 440, 441, 10, 10, 10,
+		442, 443, 10, 444, 445, 97, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 446, 10, 97, 135, 10, 135, 10, 305, 10, 305, 162, 10, 162, 10, 68, 10, 68, 10, 447, 381, 381, 381,
+		13, 13, 13, 448, 13, 13, 125, 273, 449, 174, 21, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		10, 162, 450, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 451, 452, 453, 10, 10, 10, 182, 44,
+		238, 44, 44, 44, 44, 44, 44, 44, 10, 10, 121, 454, 455, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 456, 44, 10, 10, 457, 115, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 457, 115,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 10, 255, 458, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 459, 162,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 315, 341, 44, 44, 10, 10, 10, 10, 460, 115, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 441, 10, 461, 462, 463, 464, 465, 466, 467, 300, 468, 300, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 220, 469, 44, 209, 10, 214, 10, 470, 471, 472, 473, 469, 220, 220, 220, 474, 475,
+		476, 477, 209, 478, 210, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 479, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 480, 481, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 44, 44, 44,
+		220, 220, 220, 220, 220, 220, 220, 220, 44, 44, 44, 44, 44, 44, 44, 482, 44, 44, 44, 44, 44, 483, 220, 220,
+		484, 44, 44, 44, 485, 486, 44, 44, 485, 44, 487, 220, 220, 220, 220, 220, 484, 220, 220, 488, 218, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 115, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+		220, 220, 220, 220, 220, 220, 220, 480, 489, 1, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	};
+	constexpr uint8_t BREAK_STAGE3[] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6, 5, 5, 5, 5, 7, 5, 5, 5, 5, 8, 5, 9, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 8, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 13,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 12, 5, 5, 15, 14, 5,
+		5, 5, 5, 5, 5, 12, 5, 11, 5, 5, 12, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 5, 12, 12, 5, 5, 12, 12, 12, 12, 8, 12,
+		5, 5, 5, 5, 5, 5, 12, 11, 12, 12, 12, 5, 12, 5, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5,
+		5, 12, 12, 12, 12, 5, 12, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 12, 5, 5, 5, 5, 5,
+		5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 5, 16, 5, 16, 16, 5, 16, 16, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 5, 5, 5, 5, 17, 17, 17, 17, 12, 11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		18, 18, 18, 18, 18, 18, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 5, 15, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 10, 8, 5, 12, 12, 16, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 16, 16, 16, 16, 16, 16, 16, 18, 5, 16,
+		16, 16, 16, 16, 16, 12, 12, 16, 16, 5, 16, 16, 16, 16, 12, 12, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 12, 12, 12, 5, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 19,
+		12, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 12, 12, 5, 5, 8, 5, 12, 5, 5, 16, 5, 5,
+		12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 12, 16, 16, 16,
+		12, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 5,
+		18, 18, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 21, 21, 21,
+		21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 16, 20, 16, 12, 20, 20, 20, 16, 16, 16, 16, 16, 16, 16,
+		16, 20, 20, 20, 20, 22, 20, 20, 12, 16, 16, 16, 16, 16, 16, 16, 21, 21, 21, 21, 21, 21, 21, 21,
+		12, 12, 16, 16, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 12, 12, 12, 12, 12, 12, 12,
+		21, 21, 21, 21, 21, 21, 21, 21, 12, 16, 20, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12,
+		12, 5, 5, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 5, 21, 21, 21, 21, 21, 21, 21, 5, 21, 5, 5, 5, 21, 21, 21, 21, 5, 5, 16, 12, 16, 20,
+		20, 16, 16, 16, 16, 5, 5, 20, 20, 5, 5, 20, 20, 22, 12, 5, 5, 5, 5, 5, 5, 5, 5, 16,
+		5, 5, 5, 5, 21, 21, 5, 21, 21, 21, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5, 16, 5,
+		5, 16, 16, 20, 5, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 12, 12, 5, 5, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12,
+		12, 5, 12, 12, 5, 12, 12, 5, 12, 12, 5, 5, 16, 5, 20, 20, 20, 16, 16, 5, 5, 5, 5, 16,
+		16, 5, 5, 16, 16, 16, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 5, 12, 5,
+		5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 16, 16, 12, 12, 12, 16, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12,
+		12, 12, 5, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 21, 21, 5, 21, 21, 21,
+		21, 21, 5, 5, 16, 12, 20, 20, 20, 16, 16, 16, 16, 16, 5, 16, 16, 20, 5, 20, 20, 22, 5, 5,
+		12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 21, 16, 16, 16, 16, 16, 16, 5, 16, 20, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12,
+		21, 5, 21, 21, 5, 21, 21, 21, 21, 21, 5, 5, 16, 12, 16, 16, 20, 16, 16, 16, 16, 5, 5, 20,
+		20, 5, 5, 20, 20, 22, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 5, 5, 5, 5, 21, 21, 5, 21,
+		5, 21, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 12, 5, 12, 12, 12,
+		12, 12, 12, 5, 5, 5, 12, 12, 12, 5, 12, 12, 12, 12, 5, 5, 5, 12, 12, 5, 12, 5, 12, 12,
+		5, 5, 5, 12, 12, 5, 5, 5, 12, 12, 12, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 5, 5, 5, 16, 20, 16, 20, 20, 5, 5, 5, 20, 20, 20, 5, 20, 20, 20, 16, 5, 5,
+		12, 5, 5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 16, 20, 20, 20, 16, 12, 12, 12,
+		12, 12, 12, 12, 12, 5, 12, 12, 12, 5, 12, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 5, 16, 12, 16, 16, 16, 20, 20, 20, 20, 5, 16, 16,
+		16, 5, 16, 16, 16, 22, 5, 5, 5, 5, 5, 5, 5, 16, 16, 5, 21, 21, 21, 5, 5, 12, 5, 5,
+		12, 16, 20, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 5, 5, 16, 12, 20, 16,
+		16, 20, 16, 20, 20, 5, 16, 16, 16, 5, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 16, 16, 5,
+		5, 5, 5, 5, 5, 12, 12, 5, 5, 12, 12, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		16, 16, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 21, 21, 16, 16, 12, 16, 20, 20, 16, 16, 16, 16, 5, 20, 20, 20, 5, 20, 20, 20, 22, 19, 5,
+		5, 5, 5, 5, 12, 12, 12, 16, 5, 5, 5, 5, 5, 5, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 12, 12, 12, 12, 12, 12, 5, 16, 20, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 5, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 16, 5, 5, 5, 5, 16,
+		20, 20, 16, 16, 16, 5, 16, 5, 20, 20, 20, 20, 20, 20, 20, 16, 5, 5, 20, 20, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 5, 23, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 5, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 5, 5, 5, 5, 5, 5, 5, 16, 5, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 5, 16, 5, 16, 5, 5, 5, 5, 20, 20,
+		12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 20,
+		16, 16, 16, 16, 16, 5, 16, 16, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 24, 24, 16, 16, 16, 16, 20, 16, 16, 16, 16, 16, 16, 24, 16, 16, 20, 20, 16, 16, 5,
+		5, 5, 5, 5, 5, 5, 20, 20, 16, 16, 5, 5, 5, 5, 16, 16, 16, 5, 24, 24, 24, 5, 5, 24,
+		24, 24, 24, 24, 24, 24, 5, 5, 5, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 16, 24, 20, 16, 16, 24, 24, 24, 24, 24, 24, 16, 5, 24, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 24, 24, 24, 16, 5, 5, 12, 12, 12, 12, 12, 12, 5, 12, 5, 5, 5, 5, 5, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+		27, 27, 27, 27, 27, 27, 27, 27, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 5, 12, 5, 12, 12, 12, 12, 5, 5, 12, 5, 12, 12, 12, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 5, 12, 5, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 16, 16, 16, 12, 12, 12, 12, 12, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12,
+		4, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 16, 16, 16, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 5, 16, 16, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 20, 16, 16, 16, 16, 16, 16, 16, 20, 20,
+		20, 20, 20, 20, 20, 20, 16, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 15, 16,
+		12, 12, 12, 12, 12, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 16, 12, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 16, 16, 16, 20, 20, 20, 20, 16,
+		16, 20, 20, 20, 5, 5, 5, 5, 20, 20, 16, 20, 20, 20, 20, 20, 20, 16, 16, 16, 5, 5, 5, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 16,
+		16, 20, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 20, 16, 20, 16, 16, 16, 16, 16, 16, 16, 5,
+		16, 24, 16, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 20, 20, 20, 20, 20, 20, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5,
+		16, 16, 16, 16, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 20, 20, 20, 20, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 20, 16, 16, 16, 16, 20, 20, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 16, 20,
+		16, 16, 20, 20, 20, 16, 20, 16, 12, 12, 12, 12, 20, 20, 20, 20, 20, 20, 20, 20, 16, 16, 16, 16,
+		16, 16, 16, 16, 20, 20, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 16, 16, 16, 5, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 20, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 16, 12, 12,
+		12, 12, 12, 12, 16, 12, 12, 20, 16, 16, 12, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		5, 12, 5, 12, 5, 12, 5, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 5, 12, 5,
+		5, 5, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 12, 12, 12, 12, 5, 5, 12, 12,
+		12, 12, 12, 12, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 0, 28, 29, 15, 15,
+		5, 5, 5, 5, 5, 5, 5, 5, 9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 11,
+		2, 2, 15, 15, 15, 15, 15, 13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 13,
+		13, 5, 5, 5, 8, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 4, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		5, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 16, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5, 5, 5, 5, 12, 5, 5, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 5, 12, 5, 5, 5, 12, 12, 12, 12, 12, 5, 5, 5, 5, 14, 5, 12, 5, 12, 5,
+		12, 5, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 30, 5, 5, 12, 12, 12, 12,
+		5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 5, 5, 5, 5, 12, 5, 5, 5, 5, 5, 14, 14, 14, 14,
+		14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5,
+		14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 30, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 14, 14, 14, 14, 5, 14, 14, 14, 14, 14, 14, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		14, 14, 14, 14, 14, 14, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 14, 5, 14, 5,
+		5, 5, 5, 5, 5, 14, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 14,
+		5, 5, 5, 5, 14, 5, 14, 5, 5, 5, 5, 14, 14, 14, 5, 14, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 5, 5, 14, 14, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 5, 5, 5,
+		14, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 5, 5, 5,
+		5, 5, 5, 12, 12, 12, 12, 16, 16, 16, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 16, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 12, 4, 5, 5, 5, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 14, 31, 31, 31, 31, 31, 5, 5,
+		5, 5, 5, 12, 12, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 31, 31, 5, 5, 5,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 5, 31, 31, 31, 31, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		5, 5, 5, 5, 5, 5, 5, 14, 5, 14, 5, 5, 5, 5, 5, 5, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 5, 31, 31, 31, 31, 31, 31, 31, 31, 5, 5, 5, 5, 5, 5, 5, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 12, 12, 12, 16, 12, 12, 12, 12, 16, 12, 12, 12, 12,
+		12, 12, 12, 20, 20, 16, 16, 20, 5, 5, 5, 5, 16, 5, 5, 5, 12, 12, 12, 12, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 16, 16, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 12, 12, 12, 12, 12, 12, 5, 5, 5, 12, 5, 12, 12, 16,
+		12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 12, 12, 12, 12, 12, 12, 12, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 5, 5, 5, 12, 12, 12, 16, 20, 20, 16, 16,
+		16, 16, 20, 20, 16, 16, 20, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12,
+		5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 16, 16, 16, 16, 16, 16, 20, 20, 16, 16, 20, 20, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 16, 12, 12, 12, 12, 12, 12, 12, 12, 16, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 24, 16, 24, 5, 5, 16, 5, 16, 16, 16, 5, 5, 16, 16, 5, 5, 5, 5, 5, 16, 16,
+		5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 20, 16, 16, 20, 20, 5, 5, 12, 12, 12, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 20, 20, 16, 20, 20, 16, 20, 20, 5, 20, 16, 5, 5,
+		32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+		33, 33, 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+		33, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 33, 33, 33,
+		33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		26, 26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+		27, 27, 27, 27, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 17, 16, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 5, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 5,
+		17, 17, 17, 17, 17, 5, 17, 5, 17, 17, 5, 17, 17, 5, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 11, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 13, 13, 8, 5, 9, 5, 8, 11, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 15, 5, 5, 5, 5, 5, 5, 5, 9,
+		5, 5, 5, 5, 8, 5, 9, 5, 5, 5, 5, 5, 5, 5, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 16, 5, 5, 12, 12, 12, 12, 12, 12,
+		5, 5, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 5, 5, 5,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 5, 12,
+		12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 12, 12, 12, 12, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 5, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12,
+		12, 12, 5, 12, 12, 5, 5, 5, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 5, 5, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12,
+		12, 5, 5, 5, 12, 5, 5, 12, 12, 12, 12, 5, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 16, 16, 16, 5, 16, 16, 5, 5, 5, 5, 5, 16, 16, 16, 16, 12, 12, 12, 12, 5, 12, 12, 12,
+		5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 16, 16, 16, 5, 5, 5, 5, 16,
+		12, 12, 12, 12, 12, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 5, 5, 5, 16, 16, 16, 16, 16, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 16, 16, 5, 5, 5, 5, 5, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 12,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		20, 16, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		16, 12, 12, 16, 16, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 20, 20, 20, 16, 16, 16, 16, 20,
+		20, 16, 16, 5, 5, 18, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 5, 5,
+		16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16,
+		16, 16, 16, 16, 20, 16, 16, 16, 16, 16, 16, 16, 16, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		5, 5, 5, 5, 12, 20, 20, 12, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 16, 5, 5, 12, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 20, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16, 16, 20,
+		16, 12, 19, 19, 12, 5, 5, 5, 5, 16, 16, 16, 16, 5, 20, 16, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 12, 5, 12, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 16,
+		16, 16, 20, 20, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 16, 12, 12, 16, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 5, 12, 5, 12, 12, 12, 12, 5, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 20, 20, 20, 16, 16, 16, 16, 16,
+		16, 16, 16, 5, 5, 5, 5, 5, 16, 16, 20, 20, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12,
+		12, 5, 12, 12, 5, 12, 12, 12, 12, 12, 5, 16, 16, 12, 16, 20, 16, 20, 20, 20, 20, 5, 5, 20,
+		20, 5, 5, 20, 20, 16, 5, 5, 12, 5, 5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 12, 12, 12,
+		12, 12, 20, 20, 5, 5, 16, 16, 16, 16, 16, 16, 16, 5, 5, 5, 16, 16, 16, 16, 16, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 5, 5, 12, 5,
+		12, 12, 12, 12, 12, 12, 5, 12, 16, 20, 20, 16, 16, 16, 16, 16, 16, 5, 16, 5, 5, 16, 5, 16,
+		16, 16, 20, 5, 20, 20, 16, 16, 16, 19, 16, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 20, 20, 20,
+		16, 16, 16, 16, 16, 16, 16, 16, 20, 20, 16, 16, 16, 20, 16, 12, 12, 12, 12, 5, 5, 5, 5, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 16, 12, 16, 20, 20, 16, 16, 16, 16, 16,
+		16, 20, 16, 20, 20, 16, 20, 16, 16, 20, 16, 16, 12, 12, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5,
+		20, 20, 16, 16, 16, 16, 5, 5, 20, 20, 20, 20, 16, 16, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 16, 16, 5, 5, 20, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16, 20, 20, 16, 20, 16,
+		16, 5, 5, 5, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 16, 20, 16, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16, 12, 5, 5, 5, 5, 5, 5, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 20, 16,
+		24, 24, 16, 16, 16, 16, 20, 16, 16, 16, 16, 16, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16,
+		20, 16, 16, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 5, 5, 12, 12, 12, 12,
+		12, 12, 12, 12, 5, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 16, 20, 20, 20, 20, 20, 5, 20,
+		20, 5, 5, 16, 16, 16, 16, 19, 20, 19, 20, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 16, 16, 16, 16,
+		5, 5, 16, 16, 20, 20, 20, 20, 16, 12, 5, 12, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16,
+		16, 20, 19, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5,
+		12, 16, 16, 16, 16, 16, 16, 20, 20, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 19, 19, 19, 19,
+		19, 19, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 20, 16, 16, 5, 5, 5, 12, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 16, 16, 16, 16, 16, 16, 16, 5,
+		16, 16, 16, 16, 16, 16, 20, 16, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 5, 20, 16, 16, 16, 16, 16, 16, 16, 20, 16, 16, 20, 16, 16, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 5, 12, 12, 12, 12, 12,
+		12, 16, 16, 16, 16, 16, 16, 5, 5, 5, 16, 5, 16, 16, 5, 16, 16, 16, 16, 16, 16, 16, 19, 16,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 5, 12, 12, 5, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 20, 5, 16, 16, 5, 20, 20, 16, 20, 16,
+		12, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 16, 16, 20, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		16, 16, 19, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 16, 16,
+		16, 16, 16, 5, 5, 5, 20, 20, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 16, 5, 5, 5, 5, 5, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 16, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 20, 20, 20, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 12, 12, 12,
+		12, 12, 12, 26, 12, 12, 12, 26, 26, 26, 26, 12, 12, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 5, 5, 5, 5, 16, 12, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+		20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+		5, 5, 5, 5, 5, 5, 5, 16, 12, 12, 5, 12, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		31, 31, 31, 31, 5, 31, 31, 31, 31, 31, 31, 31, 5, 31, 31, 5, 31, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 31, 31, 31, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 31, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 31, 31, 31, 31,
+		5, 5, 5, 5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 5, 16, 16, 5,
+		15, 15, 15, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 5, 5, 5, 16, 16, 16,
+		16, 16, 16, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 16, 16, 16,
+		16, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 16, 16, 16, 5, 5,
+		5, 5, 16, 16, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5, 5, 12, 12, 5,
+		5, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 5, 12, 12, 12,
+		12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12,
+		12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 5, 12, 5,
+		5, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 10, 10, 16, 16, 16, 16, 16, 16, 16, 5,
+		5, 5, 5, 16, 16, 16, 16, 16, 5, 5, 5, 5, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 5,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 5, 16, 16, 16, 16, 16,
+		16, 16, 5, 16, 16, 5, 16, 16, 16, 16, 16, 5, 5, 5, 5, 5, 16, 16, 16, 16, 16, 16, 16, 12,
+		12, 12, 12, 12, 12, 12, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 12, 5,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 5, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 16, 16, 16, 16, 12, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 5,
+		12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 5, 12, 12, 5, 12, 12, 12, 12, 16, 16, 16, 16,
+		16, 16, 16, 12, 5, 5, 5, 5, 5, 12, 12, 5, 12, 5, 5, 12, 5, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 5, 12, 12, 12, 12, 5, 12, 5, 12, 5, 5, 5, 5, 5, 5, 12, 5, 5, 5, 5, 12,
+		5, 12, 5, 12, 5, 12, 12, 12, 5, 12, 12, 5, 12, 5, 5, 12, 5, 12, 5, 12, 5, 12, 5, 12,
+		5, 12, 12, 5, 12, 5, 5, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12,
+		5, 12, 12, 12, 12, 5, 12, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12,
+		5, 12, 12, 12, 5, 12, 12, 12, 12, 12, 5, 12, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 14, 14, 14, 14,
+		30, 30, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 30, 30, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 5, 5, 5, 5, 14, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5,
+		14, 14, 14, 14, 14, 14, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 14, 14, 14, 14,
+		0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+	constexpr uint8_t SCRIPT_STAGE1[] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 17, 19, 20, 21, 22,
+		23, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 27, 27, 28, 29, 30, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+		55, 56, 57, 34, 34, 34, 34, 58, 59, 59, 60, 59, 59, 59, 59, 59, 59, 61, 62, 63, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 64, 34, 34, 34, 65, 66, 67, 68, 69, 69, 69, 69, 69, 69, 69, 69,
+		69, 69, 69, 70, 69, 71, 72, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 73,
+		74, 75, 34, 34, 34, 34, 76, 34, 34, 34, 34, 34, 34, 34, 77, 78, 79, 80, 81, 82, 83, 84, 34, 85,
+		86, 87, 88, 89, 90, 34, 91, 92, 93, 94, 17, 95, 96, 97, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 98, 25, 25, 25, 25, 25, 25, 25, 99, 100, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 101,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 102, 25, 103, 34, 34, 34, 34, 25, 104, 34, 34,
+		25, 25, 25, 25, 25, 25, 25, 25, 25, 105, 25, 25, 25, 25, 25, 25, 25, 106, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 107, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+	};
+	constexpr uint16_t SCRIPT_STAGE2[] = {
+		0, 0, 0, 0, 1, 2, 1, 2, 0, 0, 3, 3, 4, 5, 4, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 0, 0, 7, 0,
+		8, 8, 8, 8, 8, 8, 8, 9, 10, 11, 12, 11, 11, 11, 13, 11, 14, 14, 14, 14, 14, 14, 14, 14,
+		15, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 16, 17, 18, 17, 17, 19, 20, 21, 21, 22, 21, 23, 24,
+		25, 26, 27, 27, 28, 29, 27, 30, 27, 27, 27, 27, 27, 31, 27, 27, 32, 33, 33, 33, 34, 27, 27, 27,
+		35, 35, 35, 36, 37, 37, 37, 38, 39, 39, 40, 41, 42, 43, 44, 27, 45, 46, 27, 27, 27, 27, 47, 27,
+		48, 48, 48, 48, 48, 49, 50, 48, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+		67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+		91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 109, 110, 111, 112, 109,
+		113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 122, 123, 122, 124, 125, 125, 126, 127, 128, 129, 130, 131, 125, 125,
+		132, 132, 132, 132, 133, 132, 134, 135, 132, 133, 132, 136, 136, 137, 125, 125, 138, 138, 138, 138, 138, 138, 138, 138,
+		138, 138, 139, 139, 140, 139, 139, 141, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+		143, 143, 143, 143, 144, 145, 143, 143, 144, 143, 143, 146, 147, 148, 143, 143, 143, 147, 143, 143, 143, 149, 143, 150,
+		143, 151, 152, 152, 152, 152, 152, 153, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+		154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+		155, 156, 157, 157, 157, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 168, 168, 168, 168, 169, 170, 170,
+		171, 172, 173, 173, 173, 173, 173, 174, 173, 173, 175, 154, 154, 154, 154, 176, 177, 178, 179, 179, 180, 181, 182, 183,
+		184, 184, 185, 184, 186, 187, 168, 168, 188, 189, 190, 190, 190, 191, 190, 192, 193, 193, 194, 8, 195, 125, 125, 125,
+		196, 196, 196, 196, 197, 196, 196, 196, 198, 198, 198, 198, 199, 199, 199, 200, 201, 201, 201, 202, 203, 204, 204, 204,
+		205, 139, 139, 206, 207, 208, 209, 210, 4, 4, 211, 4, 4, 212, 213, 214, 4, 4, 4, 215, 8, 8, 8, 8,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 11, 216, 11, 11, 216, 217, 11, 218,
+		11, 11, 11, 219, 219, 220, 11, 221, 222, 0, 0, 0, 0, 0, 223, 224, 225, 226, 0, 0, 227, 8, 8, 228,
+		0, 0, 229, 230, 231, 0, 4, 4, 232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 233, 125, 234, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 0, 237, 0, 0, 0, 0, 0, 0,
+		238, 238, 238, 238, 238, 238, 4, 4, 239, 239, 239, 239, 239, 239, 239, 240, 139, 139, 140, 241, 241, 241, 242, 243,
+		143, 244, 245, 245, 245, 245, 14, 14, 0, 0, 0, 0, 0, 246, 125, 125, 247, 248, 247, 247, 247, 247, 247, 249,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 250, 125, 0, 251, 0, 252, 253, 254, 255, 255, 255,
+		255, 256, 257, 258, 258, 258, 258, 259, 260, 261, 261, 262, 142, 142, 142, 142, 263, 0, 261, 261, 0, 0, 264, 258,
+		142, 263, 0, 0, 0, 0, 142, 265, 0, 0, 0, 0, 0, 258, 258, 266, 258, 258, 258, 258, 258, 267, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 0, 0, 0, 0,
+		268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+		268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 269, 268, 268, 268, 270, 271, 271, 271,
+		272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 273, 125, 14, 14, 14, 14,
+		14, 14, 274, 274, 274, 274, 274, 275, 0, 0, 276, 4, 4, 4, 4, 4, 277, 4, 4, 4, 278, 279, 125, 280,
+		281, 281, 282, 233, 283, 283, 283, 284, 285, 285, 285, 285, 286, 287, 48, 48, 288, 288, 289, 290, 290, 291, 142, 292,
+		293, 293, 293, 293, 294, 295, 138, 296, 297, 297, 297, 298, 299, 300, 138, 138, 301, 301, 301, 301, 302, 303, 304, 305,
+		306, 307, 245, 4, 4, 308, 309, 152, 152, 152, 152, 152, 304, 304, 310, 311, 142, 142, 142, 142, 142, 142, 142, 142,
+		142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+		142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+		142, 142, 312, 142, 313, 142, 142, 314, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 315, 247, 247, 247, 247, 247, 247, 316, 125, 125, 317, 318, 21, 319, 320, 27, 27, 27,
+		27, 27, 27, 27, 321, 322, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+		27, 27, 27, 323, 27, 27, 27, 27, 27, 324, 27, 27, 325, 125, 125, 27, 8, 233, 326, 0, 0, 327, 328, 329,
+		27, 27, 27, 27, 27, 27, 27, 330, 331, 0, 1, 2, 1, 2, 332, 257, 258, 333, 142, 263, 334, 335, 336, 337,
+		338, 339, 340, 341, 342, 342, 125, 125, 339, 339, 339, 339, 339, 339, 339, 343, 344, 0, 0, 345, 11, 11, 11, 11,
+		346, 347, 348, 125, 125, 0, 0, 349, 125, 125, 125, 125, 125, 125, 125, 125, 350, 351, 352, 352, 352, 353, 354, 355,
+		356, 356, 357, 358, 359, 360, 360, 361, 362, 363, 364, 364, 365, 366, 125, 125, 367, 367, 367, 367, 367, 368, 368, 368,
+		369, 370, 371, 372, 372, 373, 372, 374, 375, 375, 376, 377, 377, 377, 378, 379, 379, 380, 381, 382, 383, 383, 383, 384,
+		385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 386, 385, 387, 388, 125,
+		389, 4, 4, 390, 125, 125, 125, 125, 391, 392, 392, 393, 394, 395, 396, 396, 397, 398, 399, 125, 125, 125, 400, 401,
+		402, 403, 404, 405, 125, 125, 125, 125, 406, 406, 407, 408, 407, 409, 407, 407, 410, 411, 412, 413, 414, 414, 415, 415,
+		416, 416, 125, 125, 417, 417, 418, 419, 420, 420, 420, 421, 422, 423, 424, 425, 426, 427, 428, 125, 125, 125, 125, 125,
+		429, 429, 429, 429, 430, 125, 125, 125, 431, 431, 431, 432, 431, 431, 431, 433, 434, 434, 435, 436, 437, 437, 438, 437,
+		439, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 27, 45, 440, 440, 441, 442, 443, 125, 125, 444,
+		445, 445, 446, 447, 447, 448, 125, 449, 450, 125, 125, 451, 452, 125, 453, 454, 455, 455, 455, 455, 456, 457, 455, 458,
+		459, 459, 459, 459, 460, 461, 462, 463, 464, 464, 464, 465, 466, 467, 467, 468, 469, 469, 469, 469, 469, 469, 470, 471,
+		472, 473, 472, 472, 474, 125, 125, 125, 475, 476, 477, 478, 478, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+		489, 490, 490, 491, 492, 493, 494, 125, 495, 495, 495, 495, 495, 496, 497, 125, 498, 498, 498, 498, 499, 500, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 501, 501, 501, 502, 501, 503, 125, 125, 504, 504, 504, 504, 505, 506, 507, 125,
+		508, 508, 508, 509, 509, 138, 510, 125, 511, 512, 513, 511, 514, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		515, 515, 515, 516, 125, 125, 125, 125, 125, 125, 517, 517, 517, 517, 517, 518, 519, 520, 521, 522, 523, 524, 125, 125,
+		125, 125, 525, 526, 526, 525, 527, 125, 528, 528, 528, 528, 529, 530, 530, 530, 530, 530, 531, 154, 532, 532, 532, 533,
+		534, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 535, 535, 536, 537, 538, 539, 539, 540, 541, 539, 542, 543,
+		543, 544, 545, 546, 125, 125, 125, 125, 547, 548, 548, 549, 550, 551, 552, 553, 554, 555, 556, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 557, 558, 559, 560, 559, 561, 559, 562, 125, 125,
+		125, 125, 125, 563, 564, 564, 564, 565, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+		566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+		566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 567, 125, 125, 125, 125, 125, 125,
+		566, 566, 566, 566, 566, 566, 568, 569, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 570, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 571, 571, 571, 571, 571, 571, 572, 573, 573, 573, 573, 573, 573, 573, 573,
+		573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+		573, 573, 573, 573, 573, 574, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+		573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+		573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 575, 576, 576, 576, 576, 576, 576, 576, 576,
+		576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+		576, 576, 576, 576, 577, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		578, 578, 578, 579, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 274, 274, 274, 274, 274, 274, 274, 274,
+		274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+		274, 274, 274, 580, 581, 582, 583, 584, 584, 584, 584, 585, 586, 587, 588, 589, 590, 590, 590, 590, 591, 592, 593, 594,
+		590, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 595, 595, 595, 596, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 597, 597, 597, 597,
+		597, 598, 125, 125, 125, 125, 125, 125, 599, 599, 599, 599, 600, 599, 599, 599, 601, 599, 125, 125, 125, 125, 602, 603,
+		604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604,
+		604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604,
+		604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 605, 604, 604, 604, 604, 604, 604, 604, 604,
+		604, 604, 604, 604, 604, 604, 604, 604, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+		606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 607, 125, 608, 609, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 610, 611, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 612, 613, 125, 614, 615, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+		616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 617, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 618, 618, 618, 618, 618, 618, 619, 620, 621, 622, 623, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 623, 125, 125, 125, 125, 8, 8, 624, 8, 625, 0, 0, 0,
+		0, 0, 0, 0, 623, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626,
+		0, 0, 627, 0, 0, 0, 628, 629, 630, 0, 631, 0, 0, 0, 234, 125, 11, 11, 11, 11, 632, 125, 125, 125,
+		125, 125, 125, 125, 0, 623, 0, 623, 0, 0, 0, 0, 0, 633, 0, 634, 125, 125, 125, 125, 125, 125, 125, 125,
+		0, 0, 0, 0, 0, 223, 0, 0, 0, 635, 636, 637, 638, 0, 0, 0, 639, 640, 0, 641, 642, 643, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 644, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 645, 0, 0, 0, 646, 646, 646, 646, 646, 646, 646, 646,
+		646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646,
+		646, 646, 646, 646, 646, 646, 646, 646, 647, 648, 649, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		4, 650, 651, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 652, 653, 654, 14, 14, 14, 655, 125,
+		656, 125, 125, 125, 125, 125, 125, 125, 657, 657, 658, 659, 660, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 661, 662, 125, 663, 663, 663, 664, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 665, 665, 666,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 667, 667, 668, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 669, 670,
+		671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 672, 673, 125, 125, 674, 674, 674, 674, 675, 676, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 331, 0, 0, 0, 677, 125, 125, 125, 125,
+		331, 0, 0, 246, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 678, 27, 679, 680, 681, 682, 683, 684,
+		685, 686, 687, 686, 125, 125, 125, 688, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		0, 0, 355, 0, 0, 0, 0, 0, 0, 623, 225, 331, 331, 331, 0, 626, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 246, 125, 125, 125, 689, 0, 690, 0, 0, 355, 634, 691, 626, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 692, 347, 347, 0, 0, 0, 0, 0, 0, 0, 693, 0, 0, 0, 0, 0, 233, 355, 227,
+		355, 0, 0, 0, 694, 233, 0, 0, 694, 0, 246, 355, 691, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 623, 246, 347, 695, 0, 0, 0, 696, 697, 233, 634,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 327, 0, 0, 0, 0, 0, 233, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 125, 125, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 316, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 315, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 603, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 698, 247, 247, 247, 247, 247, 247, 315, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 247, 315, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 699, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 125, 125, 125, 125, 125, 700, 125, 0, 0, 0, 0, 0, 0,
+		125, 125, 125, 125, 125, 125, 125, 125, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 125,
+	};
+	constexpr uint8_t SCRIPT_STAGE3[] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 74, 74, 74, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 74, 1, 1, 1, 1, 1, 74, 74, 74, 74, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 1, 74, 74, 74, 74, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 74, 74, 74, 74, 1, 1, 1, 1, 1, 1, 1, 74, 74, 74, 74, 74, 1, 1, 1,
+		1, 1, 15, 15, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		46, 46, 46, 46, 1, 46, 46, 46, 0, 0, 46, 46, 46, 46, 1, 46, 0, 0, 0, 0, 46, 1, 46, 1,
+		46, 46, 46, 0, 46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+		46, 46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 27, 27, 27, 27, 27, 27,
+		27, 27, 27, 27, 27, 27, 27, 27, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 2, 2, 31, 31, 31, 31, 31, 31, 31, 31, 31, 0, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 7, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+		7, 7, 7, 0, 0, 7, 7, 7, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+		56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+		0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 56,
+		56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 1, 6, 6,
+		6, 6, 6, 6, 1, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 1, 6, 6, 6, 1,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 1, 6, 6, 6, 6, 6, 6, 6,
+		6, 6, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		2, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		6, 6, 6, 6, 6, 1, 6, 6, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0, 144,
+		144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+		144, 144, 144, 0, 0, 144, 144, 144, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+		155, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105,
+		105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 0, 0, 105, 105, 105,
+		131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+		131, 131, 131, 131, 131, 131, 0, 0, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 0,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 0, 0, 85, 0, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0, 0, 0, 0, 0,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 0, 0, 0, 0, 0, 6,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 1, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 2, 2, 2, 2, 33, 33, 33,
+		33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 1, 1, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+		13, 13, 13, 13, 0, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 13, 13, 0, 0, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 13, 13, 13, 13, 13, 13,
+		13, 0, 13, 0, 0, 0, 13, 13, 13, 13, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 13,
+		13, 0, 0, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 13, 13, 0, 13,
+		13, 13, 13, 13, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 0, 0, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 49,
+		49, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 0, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 0, 49, 49, 0, 49, 49, 0, 0, 49, 0, 49, 49,
+		49, 49, 49, 0, 0, 0, 0, 49, 49, 0, 0, 49, 49, 49, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0,
+		0, 49, 49, 49, 49, 0, 49, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 0, 47, 47, 47,
+		47, 47, 47, 47, 47, 47, 0, 47, 47, 47, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+		47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 47, 47, 47, 47, 47, 47, 47, 0, 47, 47, 0, 47, 47, 47,
+		47, 47, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 47, 47, 47, 0, 47, 47, 47, 0, 0,
+		47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 0, 0, 47, 47,
+		47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47,
+		0, 120, 120, 120, 0, 120, 120, 120, 120, 120, 120, 120, 120, 0, 0, 120, 120, 0, 0, 120, 120, 120, 120, 120,
+		120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 120, 120, 120, 120, 120, 120,
+		120, 0, 120, 120, 0, 120, 120, 120, 120, 120, 0, 0, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 0, 120,
+		120, 0, 0, 120, 120, 120, 0, 0, 0, 0, 0, 0, 0, 120, 120, 120, 0, 0, 0, 0, 120, 120, 0, 120,
+		120, 120, 120, 120, 0, 0, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 151, 0, 151, 151, 151, 151, 151, 151, 0, 0, 0, 151, 151,
+		151, 0, 151, 151, 151, 151, 0, 0, 0, 151, 151, 0, 151, 0, 151, 151, 0, 0, 0, 151, 151, 0, 0, 0,
+		151, 151, 151, 0, 0, 0, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 0, 0, 151, 151,
+		151, 151, 151, 0, 0, 0, 151, 151, 151, 0, 151, 151, 151, 151, 0, 0, 151, 0, 0, 0, 0, 0, 0, 151,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+		151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 0, 0, 0, 154, 154, 154, 154, 154, 154, 154, 154,
+		154, 154, 154, 154, 154, 0, 154, 154, 154, 0, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+		154, 154, 154, 154, 154, 154, 154, 154, 154, 0, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+		154, 154, 0, 0, 154, 154, 154, 154, 154, 154, 154, 154, 154, 0, 154, 154, 154, 0, 154, 154, 154, 154, 0, 0,
+		0, 0, 0, 0, 0, 154, 154, 0, 154, 154, 154, 0, 0, 154, 0, 0, 154, 154, 154, 154, 0, 0, 154, 154,
+		154, 154, 154, 154, 154, 154, 154, 154, 0, 0, 0, 0, 0, 0, 0, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+		63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 63, 63, 63, 0, 63, 63, 63, 63, 63, 63,
+		63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 63, 63, 63, 63, 63, 63,
+		63, 63, 63, 63, 0, 63, 63, 63, 63, 63, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 63, 63,
+		63, 0, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0, 0, 63, 63, 0, 0, 0, 0, 0, 0, 63, 63, 0,
+		63, 63, 63, 63, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 63, 63, 63, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 0, 84, 84,
+		84, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 0, 84, 84, 84, 0, 84, 84, 84, 84, 84, 84,
+		0, 0, 0, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 0, 0, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 0, 137, 137, 137, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 0, 0, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 0, 137, 0, 0,
+		137, 137, 137, 137, 137, 137, 137, 0, 0, 0, 137, 0, 0, 0, 0, 137, 137, 137, 137, 137, 137, 0, 137, 0,
+		137, 137, 137, 137, 137, 137, 137, 137, 0, 0, 0, 0, 0, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		0, 0, 137, 137, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 156, 156, 156, 156, 156, 156,
+		156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+		156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 0, 0, 0, 0, 1, 156, 156, 156, 156, 156, 156, 156, 156,
+		156, 156, 156, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 73, 73, 0, 73, 0, 73, 73, 73, 73, 73, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+		73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 73, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+		73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 73, 73, 73, 73, 73, 0, 73, 0,
+		73, 73, 73, 73, 73, 73, 73, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 73, 73, 73, 73,
+		157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+		0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 0, 0, 0,
+		0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+		157, 157, 157, 157, 157, 0, 157, 157, 157, 157, 157, 157, 157, 1, 1, 1, 1, 157, 157, 0, 0, 0, 0, 0,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 42, 42, 42, 42, 42, 42, 42, 42,
+		42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 42, 0, 0, 0, 0, 0, 42, 0, 0,
+		42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 1, 42, 42, 42, 42, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 0, 40, 40, 40, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 0,
+		40, 0, 40, 40, 40, 40, 0, 0, 40, 0, 40, 40, 40, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 0,
+		40, 0, 40, 40, 40, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0, 0, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		25, 25, 25, 25, 25, 25, 0, 0, 25, 25, 25, 25, 25, 25, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+		20, 20, 20, 20, 20, 20, 20, 20, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 0, 0, 130, 130, 130, 130, 130, 130, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 1, 1, 1, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 0, 0, 0, 0, 0, 0, 0, 145, 145, 145, 145, 145, 145, 145, 145,
+		145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+		54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 0, 146, 146, 146, 0, 146, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+		69, 69, 69, 69, 69, 69, 0, 0, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 0, 0, 0, 0, 0, 0,
+		96, 96, 1, 1, 96, 1, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+		96, 96, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+		96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96,
+		96, 96, 96, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+		76, 76, 76, 76, 76, 76, 76, 0, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 0, 0, 0, 0,
+		76, 0, 0, 0, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 147, 147, 147, 147, 147, 147, 147, 147,
+		147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 0, 0,
+		147, 147, 147, 147, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 103, 103, 103, 103, 103, 103,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 0, 0, 0,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 0, 0, 0, 0, 0, 103, 103, 103, 103, 103, 103, 103, 103,
+		103, 103, 103, 0, 0, 0, 103, 103, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 18, 18, 148, 148, 148, 148, 148, 148, 148, 148,
+		148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0,
+		148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 0, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+		148, 148, 0, 0, 0, 0, 0, 0, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9,
+		141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+		75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+		0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 75, 75, 75,
+		109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 0, 0, 0, 0, 0, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 0, 42, 42, 42,
+		141, 141, 141, 141, 141, 141, 141, 141, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 1,
+		1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 46, 46,
+		46, 46, 46, 31, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 46, 46, 46,
+		46, 46, 74, 74, 74, 74, 46, 46, 46, 46, 46, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+		31, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 46,
+		46, 46, 46, 46, 46, 46, 0, 0, 46, 46, 46, 46, 46, 46, 0, 0, 46, 46, 46, 46, 46, 46, 46, 46,
+		0, 46, 0, 46, 0, 46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0, 0,
+		46, 46, 46, 46, 46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0, 0, 46, 46,
+		46, 46, 46, 46, 0, 46, 46, 46, 0, 0, 46, 46, 46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 74, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 74,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 74, 74, 74, 74, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 46, 1,
+		1, 1, 74, 74, 1, 1, 1, 1, 1, 1, 74, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 74, 1, 74, 74, 74, 74, 74, 74, 74, 74,
+		74, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 43, 43, 43, 43, 43, 43, 43, 43,
+		43, 43, 43, 43, 43, 43, 43, 43, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+		27, 27, 27, 27, 0, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 27, 158, 158, 158, 158, 158, 158, 158, 158,
+		158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 0, 0, 0, 0, 0, 0, 0, 158,
+		158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158, 40, 40, 40, 40, 40, 40, 40, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 40, 40, 40, 0, 40, 40, 40, 40, 40, 40, 40, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+		51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 51, 51, 51,
+		51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 51, 1, 51, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 51, 51, 51, 51, 51, 51, 51, 51, 51, 2, 2, 2, 2, 52, 52, 1, 1, 1, 1, 1, 1, 1, 1,
+		51, 51, 51, 51, 1, 1, 1, 1, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+		57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 0,
+		0, 2, 2, 1, 1, 57, 57, 57, 1, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 1, 1, 64, 64, 64, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0,
+		1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 1, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1,
+		64, 64, 64, 64, 64, 64, 64, 64, 1, 1, 1, 1, 1, 1, 1, 1, 169, 169, 169, 169, 169, 169, 169, 169,
+		169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 0, 0, 0,
+		169, 169, 169, 169, 169, 169, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 79, 79, 79, 79, 79, 79, 79,
+		79, 79, 79, 79, 79, 79, 79, 79, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+		164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+		1, 1, 1, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 0, 0,
+		74, 74, 0, 74, 0, 74, 74, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 74, 74, 74, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+		143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 0, 0, 0, 126, 126, 126, 126, 126, 126, 126, 126,
+		126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 0, 0, 0, 0, 0, 0, 0,
+		132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 0,
+		0, 0, 0, 0, 0, 0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 0, 0, 0, 0, 0,
+		66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+		66, 66, 66, 66, 66, 66, 1, 66, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		129, 129, 129, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 0, 1, 61, 61, 61, 61, 61, 61, 61, 61,
+		61, 61, 0, 0, 0, 0, 61, 61, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 0,
+		24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0,
+		24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 24, 24, 24, 149, 149, 149, 149, 149, 149, 149, 149,
+		149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 149, 149, 149, 149, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 40, 40, 40, 40, 40, 40, 0, 0, 40, 40, 40, 40, 40, 40, 0, 0, 40, 40, 40, 40, 40, 40, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 1, 74, 74, 74, 74,
+		74, 74, 74, 74, 74, 46, 74, 74, 74, 74, 1, 1, 0, 0, 0, 0, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 0, 0, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0, 0, 0,
+		52, 52, 52, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52, 52, 52, 52, 0,
+		0, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0, 0, 0, 0,
+		51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+		51, 51, 0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0,
+		56, 56, 56, 56, 56, 0, 56, 0, 56, 56, 0, 56, 56, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+		6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 1, 1,
+		0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		0, 0, 0, 0, 0, 0, 0, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 31, 31,
+		1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1, 1, 0, 0, 52, 52, 52, 52, 52, 52,
+		0, 0, 52, 52, 52, 52, 52, 52, 0, 0, 52, 52, 52, 52, 52, 52, 0, 0, 52, 52, 52, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 78, 78, 0, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 46, 46, 46, 46, 46, 46, 46, 46,
+		46, 46, 46, 46, 46, 46, 46, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 2, 0, 0, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+		80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 0, 0, 0, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+		112, 112, 112, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 112, 112, 44, 44, 44, 44, 44, 44, 44, 44,
+		44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0,
+		114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		114, 114, 114, 0, 0, 0, 0, 0, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+		163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 0, 163, 115, 115, 115, 115, 115, 115, 115, 115,
+		115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 0, 0, 0, 115, 115, 115, 115, 115, 115, 115, 115,
+		115, 115, 115, 115, 115, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 0, 0, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 0, 0, 0, 0, 0, 0,
+		121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 0, 0, 0, 0,
+		121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 0, 0, 0, 0,
+		38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+		0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+		22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 165, 165, 165, 165, 165, 165, 165, 165,
+		165, 165, 165, 0, 165, 165, 165, 165, 165, 165, 165, 0, 165, 165, 0, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+		165, 165, 0, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 0, 165, 165, 165, 165, 165,
+		165, 165, 0, 165, 165, 0, 0, 0, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 77, 77, 77, 77, 77, 77, 77,
+		77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 77, 77, 77, 77, 77, 77, 77,
+		0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 0, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+		74, 0, 74, 74, 74, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 0, 0,
+		29, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 0, 29, 29, 0, 0, 0, 29, 0, 0, 29, 58, 58, 58, 58, 58, 58, 58, 58,
+		58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+		124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 100, 100, 100, 100, 100, 100, 100, 100,
+		100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0,
+		0, 0, 0, 0, 0, 0, 0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 55, 55, 55, 55, 55, 55, 55, 55,
+		55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 55, 55, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55,
+		127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+		127, 127, 127, 127, 0, 0, 0, 127, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+		81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 81, 93, 93, 93, 93, 93, 93, 93, 93,
+		93, 93, 93, 93, 93, 93, 93, 93, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 0, 0, 0, 0, 92, 92, 92, 92, 0, 0, 92, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 67, 67, 67, 67, 0, 67, 67, 0, 0, 0, 0, 0, 67, 67, 67, 67,
+		67, 67, 67, 67, 0, 67, 67, 67, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+		67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 0, 0, 67, 67, 67, 0, 0, 0, 0, 67,
+		67, 67, 67, 67, 67, 67, 67, 67, 67, 0, 0, 0, 0, 0, 0, 0, 117, 117, 117, 117, 117, 117, 117, 117,
+		117, 117, 117, 117, 117, 117, 117, 117, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 0,
+		0, 0, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+		0, 8, 8, 8, 8, 8, 8, 8, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 59,
+		59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 59, 59,
+		128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0,
+		0, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128,
+		118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+		118, 0, 0, 0, 0, 0, 0, 0, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+		111, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 111, 111, 0, 0, 0, 0, 0,
+		0, 0, 111, 111, 111, 111, 111, 111, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+		53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53,
+		53, 53, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+		41, 41, 41, 41, 41, 41, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0,
+		0, 0, 0, 0, 0, 0, 41, 41, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+		168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 168, 0, 0, 168, 168, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 116, 116, 116, 116, 116, 116, 116, 116,
+		116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 0, 0, 0, 0, 0, 0, 0, 0,
+		138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+		138, 138, 0, 0, 0, 0, 0, 0, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+		119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+		62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 62, 0, 0, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+		139, 139, 139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139, 139, 139, 139, 139,
+		139, 139, 0, 0, 0, 0, 0, 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+		0, 0, 0, 0, 0, 0, 0, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+		82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 133, 133, 133, 133, 133, 133, 133,
+		133, 133, 133, 133, 133, 133, 133, 133, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70,
+		70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+		70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 0,
+		98, 0, 98, 98, 98, 98, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 98,
+		98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 71, 71, 71, 71,
+		71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0,
+		71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 45, 45, 45, 45, 0, 45, 45, 45,
+		45, 45, 45, 45, 45, 0, 0, 45, 45, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+		45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45, 0, 45, 45, 45,
+		45, 45, 0, 2, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 0, 45, 45, 0, 0, 45, 45, 45, 0, 0,
+		45, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45, 0, 0, 45, 45,
+		45, 45, 45, 45, 45, 0, 0, 0, 45, 45, 45, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 0, 162, 0, 0, 162, 0, 162, 162, 162, 162, 162, 162, 162, 162,
+		162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 0, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+		162, 0, 162, 0, 0, 162, 0, 162, 162, 162, 162, 0, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 0, 162,
+		162, 0, 0, 0, 0, 0, 0, 0, 0, 162, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+		104, 104, 104, 104, 0, 104, 104, 104, 104, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		0, 0, 0, 0, 0, 0, 0, 0, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 0, 0, 0, 0, 0, 0,
+		135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 0, 0,
+		135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 0, 0,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 0, 0, 0, 0, 0, 0,
+		96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 150, 150, 150, 150, 150, 150, 150, 150,
+		150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 0, 0, 0, 0, 0, 0,
+		99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 0, 0, 0, 0, 167, 167, 167, 167, 167, 167, 167, 167,
+		167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167,
+		34, 34, 34, 34, 34, 34, 34, 0, 0, 34, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 0, 34, 34, 0,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 0, 34, 34, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+		102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+		102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		0, 0, 0, 0, 0, 0, 0, 0, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0,
+		33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0, 0, 142, 142, 142, 142, 142, 142, 142, 142,
+		142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 0, 0, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 0, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 88, 88, 88, 88, 88, 88, 0,
+		88, 88, 0, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+		88, 88, 88, 88, 88, 88, 88, 0, 0, 0, 88, 0, 88, 88, 0, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+		0, 0, 0, 0, 0, 0, 0, 0, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 0, 0, 0, 0, 0, 0,
+		48, 48, 48, 48, 48, 48, 0, 48, 48, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0,
+		48, 48, 0, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 0, 0, 0, 0, 0, 0, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+		83, 83, 83, 83, 83, 83, 83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65,
+		65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+		65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+		65, 65, 65, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 151, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0, 0, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 0, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		28, 28, 28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+		30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 0, 0, 0, 0, 97, 97, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+		152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 0, 152, 152, 152, 152, 152, 152, 152, 152,
+		152, 152, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 11, 11, 11, 11, 11, 11, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+		123, 123, 123, 123, 123, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 123, 123, 123, 123, 123, 123, 123,
+		123, 123, 0, 123, 123, 123, 123, 123, 123, 123, 0, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+		123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 0, 0, 0, 123, 123, 123, 72, 72, 72, 72, 72, 72, 72, 72,
+		72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 0, 0, 0, 0, 0,
+		89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+		89, 89, 89, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+		94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+		0, 0, 0, 0, 0, 0, 0, 94, 153, 106, 51, 51, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153,
+		153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 0,
+		68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68,
+		153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 0, 64, 64, 64,
+		64, 64, 64, 64, 0, 64, 64, 0, 64, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+		64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 106, 106, 106, 106, 106, 106, 106, 106,
+		106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 0, 0, 0, 0,
+		36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+		36, 36, 36, 0, 0, 0, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0,
+		36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36,
+		36, 36, 0, 0, 36, 36, 36, 36, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+		2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+		2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 2, 2, 2, 2, 1, 1, 46, 46, 46, 46, 46, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 136, 136, 136, 136, 136, 136, 136, 136,
+		136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 136, 136, 136, 136, 0, 136, 136, 136, 136, 136, 136, 136,
+		136, 136, 136, 136, 136, 136, 136, 136, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 0,
+		0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 43, 43, 43, 43, 43, 43, 43, 0,
+		43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 0, 0, 43, 43, 43, 43, 43,
+		43, 43, 0, 43, 43, 0, 43, 43, 43, 43, 43, 0, 0, 0, 0, 0, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 0, 0, 0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 0, 0,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 0, 0, 0, 0, 107, 107, 161, 161, 161, 161, 161, 161, 161, 161,
+		161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0,
+		166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+		166, 166, 0, 0, 0, 0, 0, 166, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 110, 110, 110, 110, 110, 110, 110, 110,
+		110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 0, 0, 0, 0, 110,
+		40, 40, 40, 40, 40, 40, 40, 0, 40, 40, 40, 40, 0, 40, 40, 0, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 0, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+		91, 91, 91, 91, 91, 0, 0, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 0, 0, 0, 0, 3, 3, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 0, 6, 0, 0, 6,
+		0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 0, 6, 0, 6, 0, 0, 0, 0,
+		0, 0, 6, 0, 0, 0, 0, 6, 0, 6, 0, 6, 0, 6, 6, 6, 0, 6, 6, 0, 6, 0, 0, 6,
+		0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 6, 0, 6, 0, 0, 6, 6, 6, 6, 0, 6, 6, 6, 6,
+		6, 6, 6, 0, 6, 6, 6, 6, 0, 6, 6, 6, 6, 0, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+		6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+		0, 6, 6, 6, 0, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		57, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 0, 1, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	};
+	constexpr const char* SCRIPT_NAMES[] = {
+		"Unknown", "Common", "Inherited", "Adlam", "Ahom", "Anatolian_Hieroglyphs",
+		"Arabic", "Armenian", "Avestan", "Balinese", "Bamum", "Bassa_Vah",
+		"Batak", "Bengali", "Bhaiksuki", "Bopomofo", "Brahmi", "Braille",
+		"Buginese", "Buhid", "Canadian_Aboriginal", "Carian", "Caucasian_Albanian", "Chakma",
+		"Cham", "Cherokee", "Chorasmian", "Coptic", "Cuneiform", "Cypriot",
+		"Cypro_Minoan", "Cyrillic", "Deseret", "Devanagari", "Dives_Akuru", "Dogra",
+		"Duployan", "Egyptian_Hieroglyphs", "Elbasan", "Elymaic", "Ethiopic", "Garay",
+		"Georgian", "Glagolitic", "Gothic", "Grantha", "Greek", "Gujarati",
+		"Gunjala_Gondi", "Gurmukhi", "Gurung_Khema", "Han", "Hangul", "Hanifi_Rohingya",
+		"Hanunoo", "Hatran", "Hebrew", "Hiragana", "Imperial_Aramaic", "Inscriptional_Pahlavi",
+		"Inscriptional_Parthian", "Javanese", "Kaithi", "Kannada", "Katakana", "Kawi",
+		"Kayah_Li", "Kharoshthi", "Khitan_Small_Script", "Khmer", "Khojki", "Khudawadi",
+		"Kirat_Rai", "Lao", "Latin", "Lepcha", "Limbu", "Linear_A",
+		"Linear_B", "Lisu", "Lycian", "Lydian", "Mahajani", "Makasar",
+		"Malayalam", "Mandaic", "Manichaean", "Marchen", "Masaram_Gondi", "Medefaidrin",
+		"Meetei_Mayek", "Mende_Kikakui", "Meroitic_Cursive", "Meroitic_Hieroglyphs", "Miao", "Modi",
+		"Mongolian", "Mro", "Multani", "Myanmar", "Nabataean", "Nag_Mundari",
+		"Nandinagari", "New_Tai_Lue", "Newa", "Nko", "Nushu", "Nyiakeng_Puachue_Hmong",
+		"Ogham", "Ol_Chiki", "Ol_Onal", "Old_Hungarian", "Old_Italic", "Old_North_Arabian",
+		"Old_Permic", "Old_Persian", "Old_Sogdian", "Old_South_Arabian", "Old_Turkic", "Old_Uyghur",
+		"Oriya", "Osage", "Osmanya", "Pahawh_Hmong", "Palmyrene", "Pau_Cin_Hau",
+		"Phags_Pa", "Phoenician", "Psalter_Pahlavi", "Rejang", "Runic", "Samaritan",
+		"Saurashtra", "Sharada", "Shavian", "Siddham", "SignWriting", "Sinhala",
+		"Sogdian", "Sora_Sompeng", "Soyombo", "Sundanese", "Sunuwar", "Syloti_Nagri",
+		"Syriac", "Tagalog", "Tagbanwa", "Tai_Le", "Tai_Tham", "Tai_Viet",
+		"Takri", "Tamil", "Tangsa", "Tangut", "Telugu", "Thaana",
+		"Thai", "Tibetan", "Tifinagh", "Tirhuta", "Todhri", "Toto",
+		"Tulu_Tigalari", "Ugaritic", "Vai", "Vithkuqi", "Wancho", "Warang_Citi",
+		"Yezidi", "Yi", "Zanabazar_Square",
+	};
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+// A vector that stores up to N elements inline and only spills to the heap beyond that.
+// Limited to trivially copyable element types, which it moves around with plain copies.
+template<typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector only holds trivially copyable types");
+
+public:
+    SmallVector() = default;
+    SmallVector(const T* first, const T* last) { assign(first, last); }
+    SmallVector(const SmallVector& from) { assign(from.begin(), from.end()); }
+    SmallVector(SmallVector&& from) noexcept { steal(from); }
+    SmallVector& operator=(const SmallVector& from) {
+        if (this != &from) assign(from.begin(), from.end());
+        return *this;
+    }
+    SmallVector& operator=(SmallVector&& from) noexcept {
+        if (this != &from) steal(from);
+        return *this;
+    }
+
+    T* data() { return m_heap ? m_heap.get() : m_inline; }
+    const T* data() const { return m_heap ? m_heap.get() : m_inline; }
+    T* begin() { return data(); }
+    T* end() { return data() + m_size; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + m_size; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    T& operator[](size_t i) { return data()[i]; }
+    const T& operator[](size_t i) const { return data()[i]; }
+
+    void clear() { m_size = 0; }
+
+    void reserve(size_t capacity) {
+        if (capacity <= m_capacity) return;
+        capacity = std::max(capacity, m_capacity * 2);
+        std::unique_ptr<T[]> heap(new T[capacity]);
+        std::copy(begin(), end(), heap.get());
+        m_heap = std::move(heap);
+        m_capacity = capacity;
+    }
+
+    void assign(const T* first, const T* last) {
+        size_t count = last - first;
+        if (count > m_capacity) {
+            m_size = 0;
+            reserve(count);
+        }
+        std::copy(first, last, data());
+        m_size = count;
+    }
+
+    void push_back(const T& value) {
+        T copy = value; // value may live in our own storage
+        reserve(m_size + 1);
+        data()[m_size++] = copy;
+    }
+
+    T* insert(const T* pos, const T& value) {
+        size_t index = pos - begin();
+        T copy = value;
+        reserve(m_size + 1);
+        T* p = data();
+        std::copy_backward(p + index, p + m_size, p + m_size + 1);
+        p[index] = copy;
+        m_size++;
+        return p + index;
+    }
+
+    T* erase(const T* first, const T* last) {
+        T* p = data();
+        size_t from = first - p, to = last - p;
+        std::copy(p + to, p + m_size, p + from);
+        m_size -= to - from;
+        return p + from;
+    }
+
+private:
+    void steal(SmallVector& from) {
+        if (from.m_heap) {
+            m_heap = std::move(from.m_heap);
+            m_capacity = from.m_capacity;
+        } else {
+            m_heap.reset();
+            m_capacity = N;
+            std::copy(from.m_inline, from.m_inline + from.m_size, m_inline);
+        }
+        m_size = from.m_size;
+        from.m_size = 0;
+        from.m_capacity = N;
+    }
+
+    T m_inline[N];
+    std::unique_ptr<T[]> m_heap;
+    size_t m_size = 0;
+    size_t m_capacity = N;
+};
@@ -0,0 +1,154 @@
+#include "Common.h"
+#include "TextFile.h"
+#include "Utf8.h"
+#include "DocCache.h"
+
+SharedText TextFile::LoadUtf8(const std::wstring& path) {
+    static_assert(sizeof(wchar_t) == sizeof(char16_t), "UTF-16 is transcoded straight into std::wstring");
+
+    wil::unique_hfile file(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+    THROW_LAST_ERROR_IF(!file);
+
+    LARGE_INTEGER fileSize;
+    THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file.get(), &fileSize));
+    // The layout addresses text with UINT32 positions.
+    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE), static_cast<ULONGLONG>(fileSize.QuadPart) > UINT32_MAX);
+    size_t size = static_cast<size_t>(fileSize.QuadPart);
+    if (size == 0) return std::make_shared<const std::wstring>(); // empty files cannot be mapped
+
+    wil::unique_handle mapping(CreateFileMappingW(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+    THROW_LAST_ERROR_IF(!mapping);
+    wil::unique_mapview_ptr<const char> view(static_cast<const char*>(MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0)));
+    THROW_LAST_ERROR_IF(!view);
+
+    const char* bytes = view.get();
+    if (size >= 3 && memcmp(bytes, "\xEF\xBB\xBF", 3) == 0) {
+        bytes += 3;
+        size -= 3;
+    }
+
+    // UTF-8 never takes fewer bytes than UTF-16 takes code units, so the byte count bounds the result.
+    auto text = std::make_shared<std::wstring>(size, L'\0');
+    Utf8::DecodeResult decoded = Utf8::ToUtf16(bytes, size, reinterpret_cast<char16_t*>(&(*text)[0]));
+    text->resize(decoded.written);
+    if (text->capacity() > decoded.written * 2) text->shrink_to_fit(); // mostly CJK text
+    return text;
+}
+
+// Below this many code units parsing costs less than the file operations around the cache.
+static const size_t CACHE_MIN_LENGTH = 1 << 20;
+// Storing an image evicts the least recently used others until the cache fits in this.
+static const uint64_t CACHE_MAX_BYTES = uint64_t(1) << 30;
+
+static std::wstring CacheDirectory() {
+    wchar_t tempPath[MAX_PATH + 1];
+    DWORD length = GetTempPathW(MAX_PATH + 1, tempPath);
+    if (length == 0 || length > MAX_PATH) return std::wstring();
+    std::wstring dir = std::wstring(tempPath, length) + L"DxFontPreview";
+    if (!CreateDirectoryW(dir.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS) return std::wstring();
+    return dir;
+}
+
+static std::wstring CachePath(const std::wstring& dir, uint64_t key) {
+    wchar_t name[32];
+    swprintf_s(name, L"\\%016llx.doccache", static_cast<unsigned long long>(key));
+    return dir + name;
+}
+
+// Deletes the images that were used least recently, other than keep, until the rest fit in
+// CACHE_MAX_BYTES. Images mapped by a running instance cannot be deleted and are skipped.
+static void EvictCached(const std::wstring& dir, const std::wstring& keep) {
+    struct CacheFile {
+        std::wstring path;
+        uint64_t size;
+        uint64_t lastAccess;
+    };
+    std::vector<CacheFile> files;
+    uint64_t total = 0;
+    WIN32_FIND_DATAW found;
+    wil::unique_hfind find(FindFirstFileExW((dir + L"\\*.doccache").c_str(), FindExInfoBasic, &found, FindExSearchNameMatch, nullptr, 0));
+    if (!find) return;
+    do {
+        if (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) continue;
+        uint64_t size = uint64_t(found.nFileSizeHigh) << 32 | found.nFileSizeLow;
+        total += size;
+        std::wstring path = dir + L"\\" + found.cFileName;
+        if (_wcsicmp(path.c_str(), keep.c_str()) == 0) continue;
+        files.push_back({ std::move(path), size, uint64_t(found.ftLastAccessTime.dwHighDateTime) << 32 | found.ftLastAccessTime.dwLowDateTime });
+    } while (FindNextFileW(find.get(), &found));
+
+    std::sort(files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) { return a.lastAccess < b.lastAccess; });
+    for (const CacheFile& file : files) {
+        if (total <= CACHE_MAX_BYTES) break;
+        if (DeleteFileW(file.path.c_str())) total -= file.size;
+    }
+}
+
+// Keeps a cache file mapped while a document refers to its sections.
+struct MappedImage {
+    wil::unique_mapview_ptr<const uint8_t> view;
+};
+
+static bool LoadCached(const std::wstring& path, uint64_t key, ParsedDocument& doc) {
+    wil::unique_hfile file(CreateFileW(path.c_str(), GENERIC_READ | FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+    if (!file) return false;
+    // Eviction goes by the last access time, which the file system may update only lazily.
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file.get(), nullptr, &now, nullptr);
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file.get(), &fileSize) || fileSize.QuadPart <= 0 || static_cast<ULONGLONG>(fileSize.QuadPart) > SIZE_MAX) return false;
+    wil::unique_handle mapping(CreateFileMappingW(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (!mapping) return false;
+    auto image = std::make_shared<MappedImage>();
+    image->view.reset(static_cast<const uint8_t*>(MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0)));
+    if (!image->view) return false;
+
+    // The image is not verified, which would touch every page of it: only this program writes
+    // the directory, it replaces images whole, and Open catches truncated and foreign ones.
+    CachedDocument cached;
+    if (!cached.Open(image->view.get(), static_cast<size_t>(fileSize.QuadPart), key)) return false;
+    cached.Load(doc, std::move(image));
+    return true;
+}
+
+static void StoreCached(const std::wstring& dir, const std::wstring& path, uint64_t key, const ParsedDocument& doc) {
+    // Written under a temporary name and renamed, so a reader never maps a partial image.
+    std::vector<uint8_t> image = DocCache::Write(doc, key);
+    std::wstring partialPath = path + L".partial";
+    {
+        wil::unique_hfile file(CreateFileW(partialPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr));
+        if (!file) return;
+        for (size_t written = 0; written < image.size();) {
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(image.size() - written, 1 << 30)), done = 0;
+            if (!WriteFile(file.get(), image.data() + written, chunk, &done, nullptr)) {
+                file.reset();
+                DeleteFileW(partialPath.c_str());
+                return;
+            }
+            written += done;
+        }
+    }
+    if (!MoveFileExW(partialPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileW(partialPath.c_str());
+        return;
+    }
+    EvictCached(dir, path);
+}
+
+ParsedDocument TextFile::ParseCached(SharedText text, const FontSelector& fs) {
+    // Without escapes the document is the text itself, which parses in no time.
+    if (!fs.parseEscapes || text->size() < CACHE_MIN_LENGTH) return ParseInputDoc(std::move(text), fs);
+
+    // The cache is best effort: any failure to read or write it falls back to parsing.
+    uint64_t key = DocCache::KeyOf(*text, fs);
+    std::wstring dir = CacheDirectory();
+    if (dir.empty()) return ParseInputDoc(std::move(text), fs);
+    std::wstring path = CachePath(dir, key);
+    ParsedDocument doc;
+    if (LoadCached(path, key, doc)) return doc;
+    doc = ParseInputDoc(std::move(text), fs);
+    StoreCached(dir, path, key, doc);
+    return doc;
+}
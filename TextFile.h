@@ -0,0 +1,15 @@
+#pragma once
+#include "DocParser.h"
+
+namespace TextFile {
+	// Reads a UTF-8 text file through a memory mapping and transcodes it into a shared UTF-16
+	// string, ready for ParseInputDoc without a further copy. A leading byte order mark is
+	// dropped and ill-formed bytes become U+FFFD.
+	SharedText LoadUtf8(const std::wstring& path);
+
+	// Parses a large text through a document cache in the temporary directory, named after
+	// DocCache::KeyOf the text and settings. On a cache hit the document uses the text, runs,
+	// run index, styles and checkpoints of the mapped file in place; the file stays mapped for
+	// as long as the document refers to it. Smaller texts are just parsed.
+	ParsedDocument ParseCached(SharedText text, const FontSelector& fs);
+}
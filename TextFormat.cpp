@@ -2,6 +2,28 @@
 #include "FontSelector.h"
 #include "TextFormat.h"
 
+const static DWRITE_READING_DIRECTION g_dwriteReadingDirectionValues[8] = {
+    DWRITE_READING_DIRECTION_LEFT_TO_RIGHT,
+    DWRITE_READING_DIRECTION_RIGHT_TO_LEFT,
+    DWRITE_READING_DIRECTION_LEFT_TO_RIGHT,
+    DWRITE_READING_DIRECTION_RIGHT_TO_LEFT,
+    DWRITE_READING_DIRECTION_TOP_TO_BOTTOM,
+    DWRITE_READING_DIRECTION_BOTTOM_TO_TOP,
+    DWRITE_READING_DIRECTION_TOP_TO_BOTTOM,
+    DWRITE_READING_DIRECTION_BOTTOM_TO_TOP,
+};
+
+const static DWRITE_FLOW_DIRECTION g_dwriteFlowDirectionValues[8] = {
+    DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM,
+    DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM,
+    DWRITE_FLOW_DIRECTION_BOTTOM_TO_TOP,
+    DWRITE_FLOW_DIRECTION_BOTTOM_TO_TOP,
+    DWRITE_FLOW_DIRECTION_LEFT_TO_RIGHT,
+    DWRITE_FLOW_DIRECTION_LEFT_TO_RIGHT,
+    DWRITE_FLOW_DIRECTION_RIGHT_TO_LEFT,
+    DWRITE_FLOW_DIRECTION_RIGHT_TO_LEFT,
+};
+
 std::wstring GetFamilyName(wil::com_ptr<IDWriteFontFace3> fontFace) {
     wil::com_ptr<IDWriteLocalizedStrings> localizedNames;
     THROW_IF_FAILED(fontFace->GetFamilyNames(&localizedNames));
@@ -70,6 +92,11 @@ void ApplyVariation(wil::com_ptr<IDWriteFontFace3> fontFace3, wil::com_ptr<IDWri
 }
 
 
+void TextFormat::SetDirection(IDWriteTextFormat* format, ReadingDirection direction) {
+    THROW_IF_FAILED(format->SetReadingDirection(g_dwriteReadingDirectionValues[direction]));
+    THROW_IF_FAILED(format->SetFlowDirection(g_dwriteFlowDirectionValues[direction]));
+}
+
 wil::com_ptr<IDWriteTextFormat3> TextFormat::Create(wil::com_ptr<IDWriteFactory> factory, const FlowFontSource& fontSource, const FontSelector& fs) {
     wil::com_ptr<IDWriteFactory3> factory3 = factory.query<IDWriteFactory3>();
 
@@ -95,9 +122,84 @@ wil::com_ptr<IDWriteTextFormat3> TextFormat::Create(wil::com_ptr<IDWriteFactory>
     ApplyVariation(fontFace3, fmt3, fs);
     if (!fs.doFontFallback) DisableFontFallback(factory, fmt3);
 
-    THROW_IF_FAILED(fmt3->SetReadingDirection(g_dwriteReadingDirectionValues[fs.readingDirection]));
-    THROW_IF_FAILED(fmt3->SetFlowDirection(g_dwriteFlowDirectionValues[fs.readingDirection]));
+    TextFormat::SetDirection(fmt3.get(), fs.readingDirection);
     if (fs.doJustify) THROW_IF_FAILED(fmt3->SetTextAlignment(DWRITE_TEXT_ALIGNMENT_JUSTIFIED));
 
     return fmt3;
 }
+
+TextFormat::Key::Key(const FontSelector& fs)
+    : familyName(fs.familyName), styleName(fs.styleName), fontEmSize(fs.fontEmSize), readingDirection(fs.readingDirection),
+    userVariationEnabled(fs.userVariationEnabled), doFontFallback(fs.doFontFallback), doJustify(fs.doJustify) {}
+
+bool TextFormat::Key::operator==(const Key& other) const {
+    return familyName == other.familyName && styleName == other.styleName && fontEmSize == other.fontEmSize
+        && readingDirection == other.readingDirection && userVariationEnabled == other.userVariationEnabled
+        && doFontFallback == other.doFontFallback && doJustify == other.doJustify;
+}
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+size_t TextFormat::KeyHash::operator()(const Key& key) const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    // The length goes first so that the family and style names cannot run into each other.
+    for (const std::wstring* name : { &key.familyName, &key.styleName }) {
+        uint64_t length = name->size();
+        hash = HashBytes(hash, &length, sizeof(length));
+        hash = HashBytes(hash, name->data(), name->size() * sizeof(wchar_t));
+    }
+    uint32_t fields[] = { key.fontEmSize, uint32_t(key.readingDirection),
+        uint32_t(key.userVariationEnabled) | uint32_t(key.doFontFallback) << 1 | uint32_t(key.doJustify) << 2 };
+    return static_cast<size_t>(HashBytes(hash, fields, sizeof(fields)));
+}
+
+wil::com_ptr<IDWriteTextFormat3> TextFormatCache::Get(wil::com_ptr<IDWriteFactory> factory, const FlowFontSource& fontSource, const FontSelector& fs) {
+    if (fontSource.Generation() != m_fontSetGeneration) {
+        m_formats.Clear();
+        m_fontSetGeneration = fontSource.Generation();
+    }
+    TextFormat::Key key(fs);
+    if (auto cached = m_formats.Find(key)) return *cached;
+
+    // Only usable formats are kept; a selector that matches no font is looked up again next time.
+    wil::com_ptr<IDWriteTextFormat3> format = TextFormat::Create(factory, fontSource, fs);
+    if (format) m_formats.Insert(key, format);
+    return format;
+}
+
+size_t TypographyCache::FeaturesHash::operator()(const Features& features) const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    return static_cast<size_t>(HashBytes(hash, features.data(), features.size() * sizeof(RunStyleEntry)));
+}
+
+wil::com_ptr<IDWriteTypography> TypographyCache::Get(IDWriteFactory* factory, StyleSpan style) {
+    // Entries are sorted with the features first, so they are a prefix of the style set.
+    m_lookup.clear();
+    for (const auto& st : style) {
+        if (st.Type() != RunStyleType::Feature) break;
+        m_lookup.push_back(st);
+    }
+    if (auto cached = m_typographies.Find(m_lookup)) return *cached;
+
+    wil::com_ptr<IDWriteTypography> typography;
+    THROW_IF_FAILED(factory->CreateTypography(&typography));
+    for (const auto& st : m_lookup) {
+        THROW_IF_FAILED(typography->AddFontFeature({ DWRITE_FONT_FEATURE_TAG(st.Tag()), static_cast<UINT32>(st.value) }));
+    }
+    m_typographies.Insert(m_lookup, typography);
+    return typography;
+}
+
+TypographyCache::Stats TypographyCache::GetStats() const {
+    Stats stats;
+    stats.created = m_typographies.GetStats().misses;
+    stats.reused = m_typographies.GetStats().hits;
+    return stats;
+}
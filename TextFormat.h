@@ -1,8 +1,83 @@
 #pragma once
 #include "FontSelector.h"
 #include "FontSource.h"
+#include "LruCache.h"
+#include "DocParser.h"
 
 namespace TextFormat {
 	wil::com_ptr<IDWriteTextFormat3> Create(wil::com_ptr<IDWriteFactory> factory, const FlowFontSource& fontSource,
 		const FontSelector& fs);
-}
\ No newline at end of file
+	// Sets the reading and flow direction of a format, or of a whole layout.
+	void SetDirection(IDWriteTextFormat* format, ReadingDirection direction);
+
+	// The FontSelector fields Create depends on. Two selectors with equal keys get
+	// interchangeable formats from the same font source.
+	struct Key {
+		std::wstring familyName;
+		std::wstring styleName;
+		uint32_t fontEmSize;
+		ReadingDirection readingDirection;
+		bool userVariationEnabled;
+		bool doFontFallback;
+		bool doJustify;
+
+		explicit Key(const FontSelector& fs);
+		bool operator==(const Key& other) const;
+	};
+	// FNV-1a over the fields of the key, which does not change between runs or builds.
+	struct KeyHash {
+		size_t operator()(const Key& key) const;
+	};
+}
+
+// Keeps the most recently used text formats so that switching back to recent settings skips
+// filtering the font set and creating the font face, collection and format again.
+class TextFormatCache {
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 16;
+	using Stats = LruCache<TextFormat::Key, wil::com_ptr<IDWriteTextFormat3>, TextFormat::KeyHash>::Stats;
+
+	explicit TextFormatCache(size_t capacity = DEFAULT_CAPACITY) : m_formats(capacity) {}
+
+	// A format for fs, from the cache or newly created. Formats are shared between callers,
+	// so they must not be changed. Formats of an earlier font set are dropped.
+	wil::com_ptr<IDWriteTextFormat3> Get(wil::com_ptr<IDWriteFactory> factory, const FlowFontSource& fontSource,
+		const FontSelector& fs);
+
+	void Clear() { m_formats.Clear(); }
+	size_t Size() const { return m_formats.Size(); }
+	const Stats& GetStats() const { return m_formats.GetStats(); }
+
+private:
+	LruCache<TextFormat::Key, wil::com_ptr<IDWriteTextFormat3>, TextFormat::KeyHash> m_formats;
+	uint32_t m_fontSetGeneration = 0;
+};
+
+// Typography objects by their list of features, shared by all runs, layouts and documents
+// with the same features. A typography only holds features, so it never goes stale.
+class TypographyCache {
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 1024;
+	struct Stats {
+		uint64_t created = 0; // typography objects made
+		uint64_t reused = 0;  // lookups answered with an existing one
+	};
+
+	explicit TypographyCache(size_t capacity = DEFAULT_CAPACITY) : m_typographies(capacity) {}
+
+	// The typography with the feature entries of style; its variation entries are ignored.
+	wil::com_ptr<IDWriteTypography> Get(IDWriteFactory* factory, StyleSpan style);
+
+	void Clear() { m_typographies.Clear(); }
+	size_t Size() const { return m_typographies.Size(); }
+	Stats GetStats() const;
+
+private:
+	using Features = std::vector<RunStyleEntry>;
+	struct FeaturesHash {
+		size_t operator()(const Features& features) const;
+	};
+
+	LruCache<Features, wil::com_ptr<IDWriteTypography>, FeaturesHash> m_typographies;
+	Features m_lookup; // reused for the key of each lookup
+};
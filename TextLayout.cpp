@@ -3,91 +3,361 @@
 #include "TextFormat.h"
 #include "Render.h"
 #include "DocParser.h"
+#include "Paragraphs.h"
+#include "ParallelLayout.h"
+
+// What a change of FontSelector requires of the document and the layout. Every field of
+// FontSelector must be accounted for here.
+enum FontChanges : uint32_t {
+    FontChangeNone = 0,
+    FontChangeSize = 1,      // font size over the whole layout
+    FontChangeDirection = 2, // reading and flow direction of the layout
+    FontChangeLocale = 4,    // locale over the whole layout
+    FontChangeStyles = 8,    // typography and axis values of the runs
+    FontChangeDocument = 16, // the runs, re-parsed; the text stays the same
+    FontChangeText = 32,     // the text, re-parsed; needs a new layout
+    FontChangeFormat = 64    // anything else in the text format; needs a new layout
+};
+
+static uint32_t DiffFontSelectors(const FontSelector& from, const FontSelector& to) {
+    uint32_t changes = FontChangeNone;
+    if (from.familyName != to.familyName || from.styleName != to.styleName || from.userVariationEnabled != to.userVariationEnabled
+        || from.doFontFallback != to.doFontFallback || from.doJustify != to.doJustify) changes |= FontChangeFormat;
+    if (from.fontEmSize != to.fontEmSize) changes |= FontChangeSize;
+    if (from.readingDirection != to.readingDirection) changes |= FontChangeDirection;
+    if (from.localeName != to.localeName) changes |= FontChangeLocale;
+    if (from.userFeaturesEnabled != to.userFeaturesEnabled) changes |= FontChangeStyles;
+    // The compiled settings follow the settings strings, so they need no comparison of their own.
+    if (from.userFeatureSettings != to.userFeatureSettings || from.userVariationSettings != to.userVariationSettings)
+        changes |= FontChangeDocument;
+    if (from.parseEscapes != to.parseEscapes) changes |= FontChangeText;
+    return changes;
+}
+
+template<typename Fn>
+void TextLayout::ForEachLayout(Fn fn) {
+    for (const auto& entry : m_paragraphCache) fn(entry.second.layout.get(), entry.second.paragraph);
+}
 
 void TextLayout::SetFont(const FlowFontSource& fontSource, const FontSelector& fs) {
-	m_textFormat = TextFormat::Create(m_dwriteFactory, fontSource, fs);
-    m_parsedText = ParseInputDoc(m_text, fs);
+    uint32_t changes = DiffFontSelectors(m_fontState, fs);
+    // A replaced font set may have fonts of the same names that are different nonetheless.
+    if (fontSource.Generation() != m_fontSetGeneration) changes |= FontChangeFormat;
+    m_fontSetGeneration = fontSource.Generation();
+
+    m_textFormat = m_formatCache.Get(m_dwriteFactory, fontSource, fs);
+    const TextFormatCache::Stats& stats = m_formatCache.GetStats();
+    std::wostringstream s;
+    s << L"Text format cache: " << stats.hits << L" hits, " << stats.misses << L" misses, " << m_formatCache.Size() << L" entries\n";
+    OutputDebugString(s.str().c_str());
+
+    if (changes & (FontChangeDocument | FontChangeText)) m_parsedText = ParseInputDoc(m_text, fs);
     m_fontState = fs;
-    UpdateLayout();
+
+    // Change the existing layouts in place where possible instead of shaping them from scratch.
+    if (m_paragraphs.empty() || !m_textFormat || (changes & (FontChangeFormat | FontChangeText))) {
+        UpdateLayout();
+        return;
+    }
+    ForEachLayout([&](IDWriteTextLayout* layout, const Paragraph& paragraph) {
+        DWRITE_TEXT_RANGE whole{ 0, paragraph.cpEnd - paragraph.cpBegin };
+        if (changes & FontChangeSize) THROW_IF_FAILED(layout->SetFontSize(static_cast<FLOAT>(fs.fontEmSize), whole));
+        if (changes & FontChangeDirection) TextFormat::SetDirection(layout, fs.readingDirection);
+        if (changes & FontChangeLocale) (void) layout->SetLocaleName(fs.localeName.data(), whole);
+    });
+    if (changes & FontChangeDocument) {
+        // Paragraphs whose runs came out the same keep their layouts, unless all styles changed.
+        if (changes & FontChangeStyles) m_paragraphCache.clear();
+        UpdateParagraphs();
+    } else if (changes & FontChangeStyles) {
+        RunObjects objects = CreateRunObjects();
+        ForEachLayout([&](IDWriteTextLayout* layout, const Paragraph& paragraph) {
+            PrepareRunObjects(paragraph, objects);
+            ApplyStyles(layout, paragraph, true, objects);
+        });
+        ReportTypographyCache();
+    }
 }
 
 void TextLayout::SetText(const wchar_t* text, UINT32 textLength) {
-    m_text.assign(text, textLength);
-    m_parsedText = ParseInputDoc(m_text, m_fontState);
-    UpdateLayout();
+    // The parsed document may keep referring to the old text, so replace it rather than assign into it.
+    SetText(std::make_shared<const std::wstring>(text, textLength));
+}
+
+void TextLayout::SetText(SharedText text) {
+    // Find the edited range by trimming the common prefix and suffix, then re-parse only that.
+    const std::wstring& oldText = *m_text;
+    const std::wstring& newText = *text;
+    UINT32 oldLength = static_cast<UINT32>(oldText.size());
+    UINT32 textLength = static_cast<UINT32>(newText.size());
+    UINT32 prefix = static_cast<UINT32>(std::mismatch(oldText.begin(), oldText.end(), newText.begin(), newText.end()).first - oldText.begin());
+    UINT32 suffix = 0;
+    while (suffix < oldLength - prefix && suffix < textLength - prefix && oldText[oldLength - 1 - suffix] == newText[textLength - 1 - suffix]) suffix++;
+    DocumentEdit edit{ prefix, oldLength - suffix, textLength - suffix };
+
+    m_text = std::move(text);
+    m_parsedText = ParseInputDocIncremental(std::move(m_parsedText), m_text, m_fontState, edit);
+    UpdateParagraphs();
+}
+
+void TextLayout::SetText(SharedText text, ParsedDocument parsed) {
+    m_text = std::move(text);
+    m_parsedText = std::move(parsed);
+    // Another document, rather than an edit of this one, so start at its beginning.
+    m_firstVisible = 0;
+    m_scrollOffset = 0;
+    UpdateParagraphs();
 }
 
 void TextLayout::GetText(_Out_ const wchar_t** text, _Out_ UINT32* textLength) {
-    *text = &m_text[0];
-    *textLength = static_cast<UINT32>(m_text.size());
+    *text = m_text->c_str();
+    *textLength = static_cast<UINT32>(m_text->size());
 };
 
 void TextLayout::SetSize(float width, float height) {
     m_width = std::max(PADDING * 2.0, width - PADDING * 2.0);
     m_height = std::max(PADDING * 2.0, height - PADDING * 2.0);
-    if (m_layout) {
-        THROW_IF_FAILED(m_layout->SetMaxWidth(m_width));
-        THROW_IF_FAILED(m_layout->SetMaxHeight(m_height));
-    } else {
+    if (m_paragraphs.empty()) {
         UpdateLayout();
+        return;
     }
+    ForEachLayout([&](IDWriteTextLayout* layout, const Paragraph&) {
+        THROW_IF_FAILED(layout->SetMaxWidth(m_width));
+        THROW_IF_FAILED(layout->SetMaxHeight(m_height));
+    });
 }
 
 void TextLayout::Render(wil::com_ptr<IDWriteBitmapRenderTarget> target, wil::com_ptr<IDWriteRenderingParams> renderingParams, RenderMarkings options) {
-    if (!m_layout) return;
+    if (m_paragraphs.empty()) return;
+    LayOutViewport();
+
+    // Paragraphs follow each other in the flow direction: down or up for horizontal text, and
+    // right or left for vertical text. Each is laid out in the whole box, so the first one sits
+    // where it would in a layout of the whole text, and the others shift by what came before.
+    struct Placement {
+        IDWriteTextLayout* layout;
+        float x;
+        float y;
+    };
+    bool vertical = (m_fontState.readingDirection & ReadingDirectionPrimaryAxis) != 0;
+    float sign = (m_fontState.readingDirection & ReadingDirectionSecondaryProgression) ? -1.0f : 1.0f;
+    float view = ViewExtent();
+    std::vector<Placement> visible;
+    float offset = -m_scrollOffset;
+    for (size_t i = m_firstVisible; i < m_paragraphs.size() && offset < view; i++) {
+        visible.push_back({ GetParagraphLayout(i), vertical ? sign * offset : 0, vertical ? 0 : sign * offset });
+        offset += ParagraphExtent(i);
+    }
+    // Lines of the first and last paragraphs may still be out of view.
+    VisibleBand band{ vertical, 0, view };
 
     if (options) {
         wil::com_ptr<IDWriteTextRenderer1> markingsRenderer = CreateMarkingsRenderer(m_dwriteFactory, target, renderingParams, options);
-        m_layout->Draw(nullptr, markingsRenderer.get(), 0, 0);
+        for (const auto& placement : visible) placement.layout->Draw(&band, markingsRenderer.get(), placement.x, placement.y);
     }
 
     wil::com_ptr<IDWriteTextRenderer1> textRenderer = CreateTextRenderer(m_dwriteFactory, target, renderingParams);
-    m_layout->Draw(nullptr, textRenderer.get(), 0, 0);
+    for (const auto& placement : visible) placement.layout->Draw(&band, textRenderer.get(), placement.x, placement.y);
+}
+
+void TextLayout::Scroll(float delta) {
+    if (m_paragraphs.empty()) return;
+    m_scrollOffset += delta;
+    while (m_scrollOffset < 0 && m_firstVisible > 0) m_scrollOffset += ParagraphExtent(--m_firstVisible);
+    while (m_firstVisible + 1 < m_paragraphs.size() && m_scrollOffset >= ParagraphExtent(m_firstVisible)) {
+        m_scrollOffset -= ParagraphExtent(m_firstVisible++);
+    }
+    // Stop once the end of the last paragraph is in view, and at the start of the first.
+    if (m_firstVisible + 1 == m_paragraphs.size()) {
+        m_scrollOffset = std::min(m_scrollOffset, std::max(0.0f, ParagraphExtent(m_firstVisible) - ViewExtent()));
+    }
+    m_scrollOffset = std::max(m_scrollOffset, 0.0f);
 }
 
 void TextLayout::UpdateLayout() {
-    if (!m_textFormat) return;
-
-    THROW_IF_FAILED(m_dwriteFactory->CreateTextLayout(m_parsedText.text.data(), m_parsedText.text.size(), m_textFormat.get(), m_width, m_height, &m_layout));
-    (void) m_layout->SetLocaleName(m_fontState.localeName.data(), { 0, static_cast<UINT32>(m_parsedText.text.size()) });
-    for (const auto& runStyle : m_parsedText.styles) {
-        ApplyFeatures(m_layout, runStyle);
-    }
-    if (auto layout4 = m_layout.try_query<IDWriteTextLayout4>()) {
-        UINT32 axesCount = m_textFormat->GetFontAxisValueCount();
-        std::vector<DWRITE_FONT_AXIS_VALUE> defaultVariation(axesCount);
-        THROW_IF_FAILED(m_textFormat->GetFontAxisValues(defaultVariation.data(), axesCount));
-        for (const auto& runStyle : m_parsedText.styles) {
-            ApplyVariation(defaultVariation, layout4, runStyle);
+    m_paragraphCache.clear();
+    UpdateParagraphs();
+}
+
+void TextLayout::UpdateParagraphs() {
+    if (!m_textFormat) {
+        m_paragraphs.clear();
+        m_paragraphCache.clear();
+        return;
+    }
+
+    // The layouts of paragraphs that are still there carry over, so an edit only lays out the
+    // paragraphs it touched. They are made to refer to the paragraphs of the new document.
+    m_paragraphs = SplitParagraphs(m_parsedText);
+    std::unordered_map<uint64_t, CachedLayout> previous = std::move(m_paragraphCache);
+    m_paragraphCache.clear();
+    for (const Paragraph& paragraph : m_paragraphs) {
+        auto found = previous.find(paragraph.hash);
+        if (found == previous.end()) continue;
+        found->second.paragraph = paragraph;
+        m_paragraphCache.insert(previous.extract(found));
+    }
+    m_firstVisible = std::min(m_firstVisible, m_paragraphs.size() - 1);
+}
+
+void TextLayout::LayOutViewport() {
+    const float view = ViewExtent();
+    const size_t count = m_paragraphs.size();
+    m_scrollOffset = std::max(0.0f, std::min(m_scrollOffset, ParagraphExtent(m_firstVisible)));
+
+    // Keep the layouts behind the view that are still there, up to a view's worth, for scrolling back.
+    size_t begin = m_firstVisible;
+    for (float behind = 0; begin > 0 && behind < view && m_paragraphCache.count(m_paragraphs[begin - 1].hash);) {
+        behind += ParagraphExtent(--begin);
+    }
+
+    // Lay out ahead of the view in growing batches, each on the worker pool, until a view past
+    // its end is covered. A font switch thus lays out a few views' worth, whatever the length.
+    RunObjects objects = CreateRunObjects();
+    std::vector<Paragraph> missing;
+    size_t end = m_firstVisible, shaped = 0;
+    float ahead = -m_scrollOffset;
+    for (size_t batch = 8; ahead < 2 * view && end < count; batch *= 2) {
+        size_t batchEnd = std::min(count, end + batch);
+        missing.clear();
+        for (size_t i = end; i < batchEnd; i++) {
+            if (!m_paragraphCache.count(m_paragraphs[i].hash)) missing.push_back(m_paragraphs[i]);
         }
+        std::unordered_map<uint64_t, CachedLayout> laidOut;
+        ParagraphLayoutStats stats;
+        LayOutParagraphs(missing, laidOut, ThreadPool::Shared(),
+            [&](const Paragraph& paragraph) { PrepareRunObjects(paragraph, objects); },
+            [&](const Paragraph& paragraph) { return CachedLayout{ paragraph, CreateParagraphLayout(paragraph, objects) }; }, &stats);
+        m_paragraphCache.merge(laidOut);
+        shaped += stats.shaped;
+        while (end < batchEnd) ahead += ParagraphExtent(end++);
+    }
+
+    // Drop the layouts of paragraphs far from the view.
+    std::unordered_map<uint64_t, CachedLayout> kept;
+    for (size_t i = begin; i < end; i++) {
+        auto found = m_paragraphCache.find(m_paragraphs[i].hash);
+        if (found != m_paragraphCache.end()) kept.insert(m_paragraphCache.extract(found));
     }
+    size_t dropped = m_paragraphCache.size();
+    m_paragraphCache = std::move(kept);
+
+    if (!shaped && !dropped) return;
+    std::wostringstream s;
+    s << L"Paragraphs: " << count << L", " << shaped << L" laid out, " << dropped << L" dropped, " << m_paragraphCache.size() << L" kept\n";
+    OutputDebugString(s.str().c_str());
+    ReportTypographyCache();
 }
 
-void TextLayout::ApplyFeatures(wil::com_ptr<IDWriteTextLayout> layout, const RunStyle& rg) {
-    if (!m_fontState.userFeaturesEnabled) return;
-    wil::com_ptr<IDWriteTypography> typography;
-    THROW_IF_FAILED(m_dwriteFactory->CreateTypography(&typography));
-    for (const auto& st : rg.style) {
-        if (st.type != RunStyleType::Feature) continue;
-        THROW_IF_FAILED(typography->AddFontFeature({ DWRITE_FONT_FEATURE_TAG(st.tag), static_cast<UINT32>(st.value) }));
-    };
-    THROW_IF_FAILED(layout->SetTypography(typography.get(), { rg.cpBegin, rg.cpEnd }));
+IDWriteTextLayout* TextLayout::GetParagraphLayout(size_t index) {
+    const Paragraph& paragraph = m_paragraphs[index];
+    auto found = m_paragraphCache.find(paragraph.hash);
+    if (found != m_paragraphCache.end()) return found->second.layout.get();
+
+    RunObjects objects = CreateRunObjects();
+    PrepareRunObjects(paragraph, objects);
+    CachedLayout& cached = m_paragraphCache[paragraph.hash];
+    cached = { paragraph, CreateParagraphLayout(paragraph, objects) };
+    return cached.layout.get();
 }
 
-void TextLayout::ApplyVariation(const std::vector<DWRITE_FONT_AXIS_VALUE>& defaultVariation, wil::com_ptr<IDWriteTextLayout4> layout, const RunStyle& rg) {
-    if (!m_fontState.userVariationEnabled) return;
+float TextLayout::ParagraphExtent(size_t index) {
+    DWRITE_TEXT_METRICS metrics;
+    THROW_IF_FAILED(GetParagraphLayout(index)->GetMetrics(&metrics));
+    return (m_fontState.readingDirection & ReadingDirectionPrimaryAxis) ? metrics.width : metrics.height;
+}
+
+float TextLayout::ViewExtent() const {
+    return (m_fontState.readingDirection & ReadingDirectionPrimaryAxis) ? m_width : m_height;
+}
+
+wil::com_ptr<IDWriteTextLayout> TextLayout::CreateParagraphLayout(const Paragraph& paragraph, const RunObjects& objects) {
+    // DirectWrite factories are free-threaded, and a new layout belongs to this thread alone.
+    wil::com_ptr<IDWriteTextLayout> layout;
+    UINT32 length = paragraph.cpEnd - paragraph.cpBegin;
+    THROW_IF_FAILED(m_dwriteFactory->CreateTextLayout(m_parsedText.text.data() + paragraph.cpBegin, length, m_textFormat.get(), m_width, m_height, &layout));
+    (void) layout->SetLocaleName(m_fontState.localeName.data(), { 0, length });
+    ApplyStyles(layout.get(), paragraph, false, objects);
+    // Layouts shape lazily; do it here rather than on the thread that draws.
+    DWRITE_TEXT_METRICS metrics;
+    THROW_IF_FAILED(layout->GetMetrics(&metrics));
+    return layout;
+}
+
+TextLayout::RunObjects TextLayout::CreateRunObjects() {
+    // Runs share interned style sets, so the per-set objects are looked up once and indexed by style id.
+    RunObjects objects;
+    size_t styleCount = m_parsedText.styleTable.Size();
+    objects.typographies.resize(styleCount);
+    objects.variations.resize(styleCount);
+    UINT32 axesCount = m_textFormat->GetFontAxisValueCount();
+    objects.defaultVariation.resize(axesCount);
+    THROW_IF_FAILED(m_textFormat->GetFontAxisValues(objects.defaultVariation.data(), axesCount));
+    return objects;
+}
+
+void TextLayout::ApplyStyles(IDWriteTextLayout* layout, const Paragraph& paragraph, bool reset, const RunObjects& objects) {
+    // The runs of a re-parsed document need not cover the ranges the previous runs styled.
+    DWRITE_TEXT_RANGE whole{ 0, paragraph.cpEnd - paragraph.cpBegin };
+    auto layout4 = wil::try_com_query<IDWriteTextLayout4>(layout);
+    if (reset) {
+        THROW_IF_FAILED(layout->SetTypography(nullptr, whole));
+        if (layout4) THROW_IF_FAILED(layout4->SetFontAxisValues(objects.defaultVariation.data(), objects.defaultVariation.size(), whole));
+    }
+
+    // Runs crossing a paragraph separator are clipped to the paragraph.
+    for (uint32_t i = paragraph.runBegin; i < paragraph.runEnd; i++) {
+        const RunStyle& run = m_parsedText.styles[i];
+        uint32_t cpBegin = std::max(run.cpBegin, paragraph.cpBegin);
+        uint32_t cpEnd = std::min(run.cpEnd, paragraph.cpEnd);
+        DWRITE_TEXT_RANGE range{ cpBegin - paragraph.cpBegin, cpEnd - cpBegin };
+        ApplyFeatures(layout, objects, run.style, range);
+        if (layout4) ApplyVariation(layout4.get(), objects, run.style, range);
+    }
+}
+
+static std::vector<DWRITE_FONT_AXIS_VALUE> BuildAxisValues(const std::vector<DWRITE_FONT_AXIS_VALUE>& defaultVariation, StyleSpan style) {
     std::vector<DWRITE_FONT_AXIS_VALUE> axisValues(defaultVariation);
-    for (auto& st : rg.style) {
-        if (st.type != RunStyleType::Variation) continue;
+    for (auto& st : style) {
+        if (st.Type() != RunStyleType::Variation) continue;
         bool found = false;
         for (auto& item : axisValues) {
-            if (item.axisTag != st.tag) continue;
+            if (item.axisTag != st.Tag()) continue;
             item.value = st.value;
             found = true;
         }
         if (!found) {
-            axisValues.push_back({ DWRITE_FONT_AXIS_TAG(st.tag), static_cast<float>(st.value) });
+            axisValues.push_back({ DWRITE_FONT_AXIS_TAG(st.Tag()), st.value });
         }
     }
-    THROW_IF_FAILED(layout->SetFontAxisValues(axisValues.data(), axisValues.size(), { rg.cpBegin, rg.cpEnd }));
+    return axisValues;
+}
+
+void TextLayout::PrepareRunObjects(const Paragraph& paragraph, RunObjects& objects) {
+    for (uint32_t i = paragraph.runBegin; i < paragraph.runEnd; i++) {
+        StyleId style = m_parsedText.styles[i].style;
+        if (m_fontState.userFeaturesEnabled && !objects.typographies[style])
+            objects.typographies[style] = m_typographyCache.Get(m_dwriteFactory.get(), m_parsedText.styleTable.Get(style));
+        if (m_fontState.userVariationEnabled && objects.variations[style].empty())
+            objects.variations[style] = BuildAxisValues(objects.defaultVariation, m_parsedText.styleTable.Get(style));
+    }
+}
+
+void TextLayout::ApplyFeatures(IDWriteTextLayout* layout, const RunObjects& objects, StyleId style, DWRITE_TEXT_RANGE range) {
+    if (!m_fontState.userFeaturesEnabled) return;
+    THROW_IF_FAILED(layout->SetTypography(objects.typographies[style].get(), range));
+}
+
+void TextLayout::ApplyVariation(IDWriteTextLayout4* layout, const RunObjects& objects, StyleId style, DWRITE_TEXT_RANGE range) {
+    if (!m_fontState.userVariationEnabled) return;
+    const std::vector<DWRITE_FONT_AXIS_VALUE>& axisValues = objects.variations[style];
+    THROW_IF_FAILED(layout->SetFontAxisValues(axisValues.data(), axisValues.size(), range));
+}
+
+void TextLayout::ReportTypographyCache() {
+    TypographyCache::Stats typographyStats = m_typographyCache.GetStats();
+    std::wostringstream s;
+    s << L"Typography cache: " << typographyStats.created << L" created, " << typographyStats.reused << L" reused, "
+      << m_typographyCache.Size() << L" entries\n";
+    OutputDebugString(s.str().c_str());
 }
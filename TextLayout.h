@@ -3,32 +3,88 @@
 #include "FontSource.h"
 #include "FontSelector.h"
 #include "DocParser.h"
+#include "Paragraphs.h"
+#include "TextFormat.h"
 #include "Render.h"
 
 class TextLayout {
 public:
     TextLayout(wil::com_ptr<IDWriteFactory> dwriteFactory)
-        : m_dwriteFactory(dwriteFactory), m_width(300), m_height(300) {}
+        : m_dwriteFactory(dwriteFactory), m_text(std::make_shared<const std::wstring>()), m_width(300), m_height(300) {}
 
     void SetFont(const FlowFontSource& fontSource, const FontSelector& fs);
 
     void SetText(const wchar_t* text, UINT32 textLength);
+    void SetText(SharedText text);
+    // Takes text along with its document, already parsed with the current font selector.
+    void SetText(SharedText text, ParsedDocument parsed);
     void GetText(_Out_ const wchar_t** text, _Out_ UINT32* textLength);
     void SetSize(float width, float height);
 
+    // Lays out what is in view, and draws the lines in view.
     void Render(wil::com_ptr<IDWriteBitmapRenderTarget> target, wil::com_ptr<IDWriteRenderingParams> renderingParams, RenderMarkings options);
+    // Moves the view by delta DIPs along the flow direction; positive moves it toward the end.
+    void Scroll(float delta);
+    const TextFormatCache& FormatCache() const { return m_formatCache; }
+    const TypographyCache& Typographies() const { return m_typographyCache; }
 
 private:
+    // A paragraph layout, along with a paragraph of the current document that uses it. Equal
+    // paragraphs share one.
+    struct CachedLayout {
+        Paragraph paragraph;
+        wil::com_ptr<IDWriteTextLayout> layout;
+    };
+    // The objects that style runs, made once per style set in each pass over the paragraphs,
+    // then shared by the threads laying out paragraphs.
+    struct RunObjects {
+        std::vector<wil::com_ptr<IDWriteTypography>> typographies; // by style id
+        std::vector<DWRITE_FONT_AXIS_VALUE> defaultVariation;
+        std::vector<std::vector<DWRITE_FONT_AXIS_VALUE>> variations; // by style id
+    };
+
+    // Drops every paragraph layout.
     void UpdateLayout();
-    void ApplyFeatures(wil::com_ptr<IDWriteTextLayout> layout, const RunStyle& rg);
-    void ApplyVariation(const std::vector<DWRITE_FONT_AXIS_VALUE>& defaultVariation, wil::com_ptr<IDWriteTextLayout4> layout, const RunStyle& rg);
+    // Splits the document into paragraphs, keeping the layouts of those that did not change.
+    void UpdateParagraphs();
+    // Lays out the paragraphs from one view before the visible ones to one view past them,
+    // and drops the layouts of all others.
+    void LayOutViewport();
+    // The layout of a paragraph, laid out now if it has none.
+    IDWriteTextLayout* GetParagraphLayout(size_t index);
+    // Size of a paragraph along the flow direction, and of the view.
+    float ParagraphExtent(size_t index);
+    float ViewExtent() const;
+    // Called concurrently for different paragraphs.
+    wil::com_ptr<IDWriteTextLayout> CreateParagraphLayout(const Paragraph& paragraph, const RunObjects& objects);
+    // Calls fn once for each layout there is, with a paragraph using it.
+    template<typename Fn> void ForEachLayout(Fn fn);
+    RunObjects CreateRunObjects();
+    // Makes the objects for the runs of paragraph that objects does not have yet.
+    void PrepareRunObjects(const Paragraph& paragraph, RunObjects& objects);
+    // Applies the typography and axis values of the runs, clearing earlier ones first if reset.
+    // The objects of the runs must have been prepared.
+    void ApplyStyles(IDWriteTextLayout* layout, const Paragraph& paragraph, bool reset, const RunObjects& objects);
+    void ApplyFeatures(IDWriteTextLayout* layout, const RunObjects& objects, StyleId style, DWRITE_TEXT_RANGE range);
+    void ApplyVariation(IDWriteTextLayout4* layout, const RunObjects& objects, StyleId style, DWRITE_TEXT_RANGE range);
+    void ReportTypographyCache();
 
     wil::com_ptr<IDWriteFactory> m_dwriteFactory;
     FontSelector m_fontState;
-    std::wstring m_text;
+    SharedText m_text;
     ParsedDocument m_parsedText;
+    TextFormatCache m_formatCache;
+    // Outlives the layouts, since the typography of a feature list does not depend on the font.
+    TypographyCache m_typographyCache;
+    uint32_t m_fontSetGeneration = 0;
     wil::com_ptr<IDWriteTextFormat3> m_textFormat;
-    wil::com_ptr<IDWriteTextLayout> m_layout;
+    std::vector<Paragraph> m_paragraphs; // in document order
+    // The layouts of paragraphs in and near the view by Paragraph::hash. They all have the
+    // current format and font settings, which change them all in place or empty the map.
+    std::unordered_map<uint64_t, CachedLayout> m_paragraphCache;
+    // The view starts m_scrollOffset DIPs into paragraph m_firstVisible, along the flow direction.
+    size_t m_firstVisible = 0;
+    float m_scrollOffset = 0;
 
     float m_width;
     float m_height;
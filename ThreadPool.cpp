@@ -0,0 +1,124 @@
+#include "PortableCommon.h"
+#include "ThreadPool.h"
+
+static uint64_t PackRange(uint64_t begin, uint64_t end) {
+    return (begin << 32) | end;
+}
+
+static size_t RangeBegin(uint64_t range) {
+    return static_cast<size_t>(range >> 32);
+}
+
+static size_t RangeEnd(uint64_t range) {
+    return static_cast<size_t>(range & 0xFFFFFFFF);
+}
+
+ThreadPool::ThreadPool(size_t threads) : m_workers(std::max<size_t>(threads, 1)) {
+    for (size_t j = 1; j < m_workers.size(); j++) m_threads.emplace_back(&ThreadPool::ThreadMain, this, j);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& t : m_threads) t.join();
+}
+
+ThreadPool& ThreadPool::Shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grain, const Body& body) {
+    if (!count) return;
+    if (count > UINT32_MAX) throw std::length_error("ThreadPool::ParallelFor: too many items");
+    std::lock_guard<std::mutex> call(m_callMutex);
+
+    const size_t workers = m_workers.size();
+    for (size_t j = 0; j < workers; j++) {
+        m_workers[j].range.store(PackRange(count * j / workers, count * (j + 1) / workers), std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_body = &body;
+        m_grain = std::max<size_t>(grain, 1);
+        m_running = m_threads.size();
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    Run(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_running == 0; });
+    m_body = nullptr;
+    if (m_error) std::rethrow_exception(std::exchange(m_error, nullptr));
+}
+
+void ThreadPool::ThreadMain(size_t worker) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_exit || m_generation != seen; });
+            if (m_exit) return;
+            seen = m_generation;
+        }
+        Run(worker);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_running == 0) m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::Run(size_t worker) {
+    try {
+        RunChunks(worker);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error) m_error = std::current_exception();
+    }
+}
+
+void ThreadPool::RunChunks(size_t worker) {
+    std::atomic<uint64_t>& own = m_workers[worker].range;
+    do {
+        uint64_t range = own.load(std::memory_order_acquire);
+        while (RangeBegin(range) < RangeEnd(range)) {
+            size_t begin = RangeBegin(range);
+            size_t end = std::min(RangeEnd(range), begin + m_grain);
+            if (!own.compare_exchange_weak(range, PackRange(end, RangeEnd(range)), std::memory_order_acq_rel)) continue;
+            (*m_body)(worker, begin, end);
+            range = own.load(std::memory_order_acquire);
+        }
+    } while (Steal(worker));
+}
+
+bool ThreadPool::Steal(size_t worker) {
+    for (;;) {
+        size_t victim = SIZE_MAX, largest = 0;
+        uint64_t victimRange = 0;
+        for (size_t j = 0; j < m_workers.size(); j++) {
+            if (j == worker) continue;
+            uint64_t range = m_workers[j].range.load(std::memory_order_acquire);
+            size_t remaining = RangeEnd(range) > RangeBegin(range) ? RangeEnd(range) - RangeBegin(range) : 0;
+            if (remaining > largest) {
+                largest = remaining;
+                victim = j;
+                victimRange = range;
+            }
+        }
+        if (victim == SIZE_MAX) return false;
+
+        // Take the back half, or the last item, leaving the victim its front.
+        size_t begin = RangeBegin(victimRange), end = RangeEnd(victimRange);
+        size_t split = end - (end - begin + 1) / 2;
+        if (m_workers[victim].range.compare_exchange_strong(victimRange, PackRange(begin, split), std::memory_order_acq_rel)) {
+            m_workers[worker].range.store(PackRange(split, end), std::memory_order_release);
+            return true;
+        }
+    }
+}
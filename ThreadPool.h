@@ -0,0 +1,51 @@
+#pragma once
+
+// A fixed set of worker threads for data-parallel loops. Each worker owns a range of the
+// iteration space and takes chunks from its front; a worker that runs out steals the back
+// half of the largest remaining range, so uneven items still balance across threads.
+class ThreadPool {
+public:
+	using Body = std::function<void(size_t worker, size_t begin, size_t end)>;
+
+	explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+	~ThreadPool();
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Number of workers, counting the thread that calls ParallelFor.
+	size_t Size() const { return m_workers.size(); }
+
+	// Calls body on chunks of at most grain items covering [0, count), on the pool threads and
+	// the calling thread, and returns once all of them are done. No two concurrent calls of body
+	// share a worker index in [0, Size()). The first exception thrown by body is rethrown here
+	// once every worker has stopped. Must not be called from inside body.
+	void ParallelFor(size_t count, size_t grain, const Body& body);
+
+	static ThreadPool& Shared();
+
+private:
+	// [begin, end) packed into one word so that owner and thieves can update it atomically.
+	struct alignas(64) Worker {
+		std::atomic<uint64_t> range{ 0 };
+	};
+
+	void Run(size_t worker);
+	void RunChunks(size_t worker);
+	void ThreadMain(size_t worker);
+	bool Steal(size_t worker);
+
+	std::vector<Worker> m_workers;
+	std::vector<std::thread> m_threads;
+
+	std::mutex m_callMutex; // serializes ParallelFor calls
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	uint64_t m_generation = 0;
+	size_t m_running = 0;
+	bool m_exit = false;
+
+	const Body* m_body = nullptr;
+	size_t m_grain = 1;
+	std::exception_ptr m_error;
+};
@@ -0,0 +1,147 @@
+#include "PortableCommon.h"
+#include "Utf8.h"
+#include "BitScan.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define UTF8_SSE2 1
+#include <emmintrin.h>
+#else
+#define UTF8_SSE2 0
+#endif
+
+// Decodes the sequence at src[i], which is not ASCII, and advances i past it.
+static void DecodeSequenceSlow(const uint8_t* src, size_t n, size_t& i, char16_t*& dst, Utf8::DecodeResult& result);
+
+static inline void DecodeSequence(const uint8_t* src, size_t n, size_t& i, char16_t*& dst, Utf8::DecodeResult& result) {
+    // Fast paths for well-formed two and three byte sequences, which make up most non-ASCII text.
+    uint8_t lead = src[i];
+    if (lead >= 0xC2 && lead <= 0xDF && i + 1 < n && (src[i + 1] & 0xC0) == 0x80) {
+        *dst++ = static_cast<char16_t>(((lead & 0x1F) << 6) | (src[i + 1] & 0x3F));
+        i += 2;
+        return;
+    }
+    if ((lead & 0xF0) == 0xE0 && i + 2 < n && (src[i + 1] & 0xC0) == 0x80 && (src[i + 2] & 0xC0) == 0x80) {
+        uint32_t cp = ((lead & 0x0F) << 12) | ((src[i + 1] & 0x3F) << 6) | (src[i + 2] & 0x3F);
+        if (cp >= 0x800 && (cp < 0xD800 || cp > 0xDFFF)) {
+            *dst++ = static_cast<char16_t>(cp);
+            i += 3;
+            return;
+        }
+    }
+    DecodeSequenceSlow(src, n, i, dst, result);
+}
+
+static void DecodeSequenceSlow(const uint8_t* src, size_t n, size_t& i, char16_t*& dst, Utf8::DecodeResult& result) {
+    uint8_t lead = src[i];
+    // Well-formed sequences per table 3-7 of the Unicode standard: the range allowed for the
+    // second byte depends on the lead byte, the later bytes are always 80..BF.
+    uint32_t length = 0, cp = 0;
+    uint8_t lo = 0x80, hi = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2; cp = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3; cp = lead & 0x0F;
+        if (lead == 0xE0) lo = 0xA0;
+        if (lead == 0xED) hi = 0x9F; // no surrogates
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4; cp = lead & 0x07;
+        if (lead == 0xF0) lo = 0x90;
+        if (lead == 0xF4) hi = 0x8F; // nothing past U+10FFFF
+    }
+
+    size_t start = i++;
+    bool valid = length != 0;
+    for (uint32_t k = 1; valid && k < length; k++) {
+        if (i >= n || src[i] < lo || src[i] > hi) {
+            valid = false;
+            break;
+        }
+        cp = (cp << 6) | (src[i++] & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    if (!valid) {
+        // The maximal subpart consumed so far becomes a single replacement character.
+        if (result.errors++ == 0) result.firstError = start;
+        *dst++ = 0xFFFD;
+    } else if (cp >= 0x10000) {
+        cp -= 0x10000;
+        *dst++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+        *dst++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+    } else {
+        *dst++ = static_cast<char16_t>(cp);
+    }
+}
+
+Utf8::DecodeResult Utf8::ToUtf16Scalar(const char* src, size_t n, char16_t* dst) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+    char16_t* out = dst;
+    DecodeResult result;
+    size_t i = 0;
+    while (i < n) {
+        if (p[i] < 0x80) {
+            *out++ = p[i++];
+        } else {
+            DecodeSequence(p, n, i, out, result);
+        }
+    }
+    result.written = out - dst;
+    return result;
+}
+
+#if UTF8_SSE2
+
+// Widens the ASCII prefix of src and returns its length. Whole blocks of 16 bytes are stored,
+// which stays within dst since the output never runs ahead of the input.
+static size_t WidenAsciiSse2(const uint8_t* src, size_t n, char16_t* dst) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(v)); // bytes with the high bit set
+        if (mask) return i + BitScan::Lowest(mask);
+    }
+    return i;
+}
+
+Utf8::DecodeResult Utf8::ToUtf16(const char* src, size_t n, char16_t* dst) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+    char16_t* out = dst;
+    DecodeResult result;
+    size_t i = 0;
+    while (i < n) {
+        if (p[i] < 0x80) {
+            size_t ascii = WidenAsciiSse2(p + i, n - i, out);
+            i += ascii;
+            out += ascii;
+        }
+        // Decode the non-ASCII run that follows, plus the tail shorter than a block, one
+        // sequence at a time. Single ASCII bytes within the run, such as the spaces between
+        // words of Cyrillic or Greek text, are taken along, since the vector loop would stop
+        // right after them. A long run, as in CJK text, is taken in stretches of 64 bytes
+        // before going back to the vector loop.
+        size_t stop = std::min(n, i + 64);
+        bool tail = n - i < 16;
+        while (i < stop) {
+            if (p[i] >= 0x80) {
+                DecodeSequence(p, n, i, out, result);
+            } else if (tail || i + 1 == n || p[i + 1] >= 0x80) {
+                *out++ = p[i++];
+            } else {
+                break;
+            }
+        }
+    }
+    result.written = out - dst;
+    return result;
+}
+
+#else
+
+Utf8::DecodeResult Utf8::ToUtf16(const char* src, size_t n, char16_t* dst) {
+    return ToUtf16Scalar(src, n, dst);
+}
+
+#endif
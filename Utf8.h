@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Utf8 {
+	struct DecodeResult {
+		size_t written = 0;          // UTF-16 code units written
+		size_t errors = 0;           // ill-formed subsequences, each replaced by one U+FFFD
+		size_t firstError = SIZE_MAX; // byte offset of the first of them
+	};
+
+	// Transcodes UTF-8 to UTF-16. dst must have room for n code units, which is never exceeded.
+	// Ill-formed input is replaced following the Unicode recommendation of one U+FFFD per
+	// maximal subpart. Runs of ASCII are widened with SSE2 when available.
+	DecodeResult ToUtf16(const char* src, size_t n, char16_t* dst);
+
+	// Portable reference implementation of ToUtf16.
+	DecodeResult ToUtf16Scalar(const char* src, size_t n, char16_t* dst);
+}
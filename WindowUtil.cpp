@@ -676,6 +676,16 @@ float WinUtil::GetNumOfTextBox(HWND box, const float& defaultValue) {
     }
 }
 
+void WinUtil::SetTextBoxTip(HWND box, const std::wstring& title, const std::wstring& message) {
+    if (!box) return;
+    if (message.empty()) {
+        Edit_HideBalloonTip(box);
+        return;
+    }
+    EDITBALLOONTIP tip = { sizeof(tip), title.c_str(), message.c_str(), TTI_WARNING };
+    Edit_ShowBalloonTip(box, &tip);
+}
+
 void WinUtil::SetComboBoxItem(HWND box, const std::wstring& str) {
     LRESULT matchIndex = SendMessage(box, CB_FINDSTRING, -1, LPARAM(str.c_str()));
     if (matchIndex != CB_ERR) {
@@ -159,4 +159,7 @@ namespace WinUtil {
     float GetNumOfTextBox(HWND box, const float& defaultValue);
 
     void SetComboBoxItem(HWND box, const std::wstring& str);
+
+    // Shows message in a balloon tip at the text box, or hides the tip if message is empty.
+    void SetTextBoxTip(HWND box, const std::wstring& title, const std::wstring& message);
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+// Time to load a document cache image from a file, against the time to map the file, over
+// documents of growing size. Loading uses the image in place, so it should track the map time
+// rather than the size; copying the sections out, as loading once did, and verifying them are
+// timed for comparison, along with parsing the text instead.
+// Usage: DocCacheBench [--size <code units of the largest document>] [--repeat <n>]
+#include "PortableCommon.h"
+#include "DocParser.h"
+#include "DocCache.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A read-only mapping of a whole file.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER size;
+        HANDLE mapping = GetFileSizeEx(file, &size) ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        if (mapping) {
+            m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (m_data) m_size = static_cast<size_t>(size.QuadPart);
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) == 0) {
+            void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_data = data;
+                m_size = static_cast<size_t>(st.st_size);
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile() {
+        if (!m_data) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data);
+#else
+        munmap(m_data, m_size);
+#endif
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const void* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+// Styles that mostly differ from each other, so the runs and the style table grow with the text.
+static std::wstring DistinctStyles(size_t size) {
+    std::wstring text;
+    for (uint32_t i = 0; text.size() < size; i++)
+        text += L"\\{\\v{wght=" + std::to_wstring(100 + i % 800) + L"}\\f{ss" + std::to_wstring(10 + i % 10) + L"}word\\} ";
+    return text;
+}
+
+// Best time of repeat runs of fn, in seconds.
+template<typename Fn>
+static double Best(int repeat, Fn fn) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+// What loading did before documents used the image in place: copy the runs and checkpoints,
+// intern the style sets into a new table and rebuild the run index.
+static size_t CopySections(const ParsedDocument& loaded) {
+    ParsedDocument doc;
+    doc.styles = std::vector<RunStyle>(loaded.styles.begin(), loaded.styles.end());
+    doc.checkpoints = std::vector<ParseCheckpoint>(loaded.checkpoints.begin(), loaded.checkpoints.end());
+    for (StyleId id = 0; id < loaded.styleTable.Size(); id++) {
+        StyleSpan entries = loaded.styleTable.Get(id);
+        doc.styleTable.Intern(entries.data(), entries.size());
+    }
+    doc.runIndex = RunIndex(doc.styles);
+    return doc.runIndex.Size();
+}
+
+static bool Report(size_t size, const std::string& path, int repeat) {
+    FontSelector fs;
+    fs.parseEscapes = true;
+    std::wstring text = DistinctStyles(size);
+    ParsedDocument doc;
+    double parse = Best(repeat, [&] { doc = ParseInputDoc(text, fs); });
+    uint64_t key = DocCache::KeyOf(text, fs);
+    {
+        std::vector<uint8_t> image = DocCache::Write(doc, key);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(image.data()), image.size());
+        if (!file) return false;
+    }
+
+    size_t imageSize = 0;
+    double map = Best(repeat, [&] {
+        MappedFile file(path);
+        imageSize = file.Size();
+    });
+    bool loadedAll = true;
+    double load = Best(repeat, [&] {
+        auto file = std::make_shared<MappedFile>(path);
+        CachedDocument cached;
+        ParsedDocument loaded;
+        if (cached.Open(file->Data(), file->Size(), key)) {
+            cached.Load(loaded, file);
+        } else {
+            loadedAll = false;
+        }
+    });
+    if (!loadedAll) return false;
+
+    MappedFile file(path);
+    CachedDocument cached;
+    ParsedDocument loaded;
+    cached.Open(file.Data(), file.Size(), key);
+    cached.Load(loaded, nullptr);
+    bool verified = true;
+    double verify = Best(repeat, [&] { verified = cached.Verify(); });
+    size_t indexed = 0;
+    double copy = Best(repeat, [&] { indexed = CopySections(loaded); });
+    if (!verified || indexed != doc.styles.size()) fprintf(stderr, "%zu units: the loaded image does not match\n", size);
+
+    printf("%10zu units %9zu runs %8.1f MB | map %7.1f us, map+load %7.1f us | verify %8.3f ms, copy %8.3f ms, parse %8.3f ms\n",
+        text.size(), doc.styles.size(), imageSize / 1e6, map * 1e6, load * 1e6, verify * 1e3, copy * 1e3, parse * 1e3);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    size_t size = 32000000;
+    int repeat = 5;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else {
+            fprintf(stderr, "unknown argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / "DocCacheBench.doccache").string();
+    bool ok = true;
+    for (size_t units = std::max<size_t>(size >> 10, 1); ok && units <= size; units *= 4) ok = Report(units, path, repeat);
+    std::remove(path.c_str());
+    if (!ok) fprintf(stderr, "cannot write or load %s\n", path.c_str());
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,336 @@
+// Throughput of the document parser on synthetic corpora and on UTF-8 files, and of the steps of
+// parsing on their own, each against the way it used to be done.
+// Usage: DocParserBench [--size <code units per synthetic corpus>] [--repeat <n>] [file...]
+#include "PortableCommon.h"
+#include "DocParser.h"
+#include "CharScan.h"
+#include "Utf8.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+// Bytes currently allocated through operator new, so that the memory of a parsed document can be
+// told apart. The size is kept in front of each block.
+static std::atomic<size_t> g_liveBytes{ 0 };
+
+void* operator new(size_t size) {
+    void* block = malloc(size + 16);
+    if (!block) throw std::bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    g_liveBytes += size;
+    return static_cast<char*>(block) + 16;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    void* block = static_cast<char*>(p) - 16;
+    g_liveBytes -= *static_cast<size_t*>(block);
+    free(block);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+// Bytes that a copy of value allocates, which for vectors and hash tables is what they hold.
+template<typename T>
+static size_t Footprint(const T& value) {
+    size_t before = g_liveBytes;
+    T copy(value);
+    return g_liveBytes - before;
+}
+
+struct Corpus {
+    std::string name;
+    std::wstring text;
+};
+
+static std::wstring Repeat(const std::wstring& unit, size_t size) {
+    std::wstring text;
+    text.reserve(size + unit.size());
+    while (text.size() < size) text += unit;
+    return text;
+}
+
+// Styles that mostly differ from each other, so the style table grows with the text.
+static std::wstring DistinctStyles(size_t size) {
+    std::wstring text;
+    for (uint32_t i = 0; text.size() < size; i++)
+        text += L"\\{\\v{wght=" + std::to_wstring(100 + i % 800) + L"}\\f{ss" + std::to_wstring(10 + i % 10) + L"}word\\} ";
+    return text;
+}
+
+static std::vector<Corpus> SyntheticCorpora(size_t size) {
+    return {
+        { "latin", Repeat(L"The quick brown fox jumps over the lazy dog. ", size) },
+        { "cjk", Repeat(L"\x79C1\x306F\x30AC\x30E9\x30B9\x3092\x98DF\x3079\x3089\x308C\x307E\x3059\x3002", size) },
+        { "escape-heavy", Repeat(L"ab\\f{liga}c\\{\\v{wght=700}de\\}\\u0041\\t", size) },
+        { "nested", Repeat(L"\\{\\f{smcp}a\\{\\f{onum}b\\{\\v{wdth=80}c\\}\\}\\}", size) },
+        { "distinct-styles", DistinctStyles(size) },
+    };
+}
+
+static bool LoadCorpus(const char* path, Corpus& corpus) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::u16string utf16(bytes.size(), u'\0');
+    utf16.resize(Utf8::ToUtf16(bytes.data(), bytes.size(), &utf16[0]).written);
+    corpus.name = path;
+    corpus.text.assign(utf16.begin(), utf16.end());
+    return true;
+}
+
+// Best time of repeat runs of fn, in seconds.
+template<typename Fn>
+static double Best(int repeat, Fn fn) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+static void Report(const Corpus& corpus, int repeat) {
+    FontSelector fs;
+    fs.userFeaturesEnabled = true;
+    fs.userFeatureSettings = L"kern, liga=0";
+    fs.compiledSettings = CompileStyleSettings(fs);
+
+    ParsedDocument doc = ParseInputDoc(corpus.text, fs);
+    double mb = corpus.text.size() * 2 / 1e6; // as UTF-16
+    double parse = Best(repeat, [&] { ParseInputDoc(corpus.text, fs); });
+    double segmented = Best(repeat, [&] { ParseInputDoc(corpus.text, fs, ParseSegmentation); });
+    double stream = Best(repeat, [&] {
+        DocumentSink sink;
+        sink.text = [](const std::wstring_view&) {};
+        sink.run = [](const RunStyle&, StyleSpan) {};
+        DocumentStreamParser parser(fs, sink);
+        std::wstring_view text(corpus.text);
+        for (size_t pos = 0; pos < text.size(); pos += 65536) parser.Feed(text.substr(pos, 65536));
+        parser.Finish();
+    });
+    printf("%-16s %8.2f MB %9zu runs %6zu styles | parse %7.1f MB/s, segmented %7.1f MB/s, stream %7.1f MB/s\n",
+        corpus.name.c_str(), mb, doc.styles.size(), doc.styleTable.Size(), mb / parse, mb / segmented, mb / stream);
+}
+
+// Building the parsed text on its own: one character at a time into a stream, as DocumentBuilder
+// used to, against escape-free spans appended to a buffer reserved to the input length.
+static void ReportBuilder(const Corpus& corpus, int repeat) {
+    std::wstring_view text(corpus.text);
+    size_t streamed = 0, appended = 0;
+    double stream = Best(repeat, [&] {
+        std::wstringstream out;
+        for (wchar_t ch : text) {
+            if (ch != L'\\' && ch != 0) out << ch;
+        }
+        streamed = out.str().size();
+    });
+    double bulk = Best(repeat, [&] {
+        std::wstring out;
+        out.reserve(text.size());
+        for (size_t pos = 0; pos < text.size(); pos++) {
+            size_t length = CharScan::FindEscapeScalar(text.data() + pos, text.size() - pos);
+            out.append(text.substr(pos, length));
+            pos += length;
+        }
+        appended = out.size();
+    });
+    if (streamed != appended) fprintf(stderr, "%s: the builders disagree\n", corpus.name.c_str());
+    double mb = text.size() * 2 / 1e6;
+    printf("%-16s | stream %7.1f MB/s, bulk append %7.1f MB/s\n", corpus.name.c_str(), mb / stream, mb / bulk);
+}
+
+// Finding the escapes, one code unit at a time against FindEscape with the vector units at hand.
+static void ReportScan(const Corpus& corpus, int repeat) {
+    std::wstring_view text(corpus.text);
+    size_t scalarHits = 0, vectorHits = 0;
+    auto scan = [&](size_t (*find)(const wchar_t*, size_t), size_t& hits) {
+        hits = 0;
+        for (size_t pos = 0; pos < text.size(); pos++) {
+            pos += find(text.data() + pos, text.size() - pos);
+            if (pos < text.size()) hits++;
+        }
+    };
+    double scalar = Best(repeat, [&] { scan(CharScan::FindEscapeScalar, scalarHits); });
+    double vector = Best(repeat, [&] { scan(CharScan::FindEscape, vectorHits); });
+    if (scalarHits != vectorHits) fprintf(stderr, "%s: the scans disagree\n", corpus.name.c_str());
+    double mb = text.size() * 2 / 1e6;
+    printf("%-16s | %9zu escapes | scalar %7.1f MB/s, vector %7.1f MB/s\n", corpus.name.c_str(), scalarHits,
+        mb / scalar, mb / vector);
+}
+
+// Parsing deeply nested scopes under 16 root features. Scopes share the style set of their parent,
+// so the time per scope should not grow with the depth; for comparison, copying the full style
+// state into every scope, as the builder used to, is timed on its own.
+static void ReportNesting(int repeat) {
+    FontSelector fs;
+    fs.userFeaturesEnabled = true;
+    for (int i = 1; i <= 16; i++) fs.userFeatureSettings += (i > 1 ? L", ss" : L"ss") + std::wstring(i < 10 ? L"0" : L"") + std::to_wstring(i);
+    fs.compiledSettings = CompileStyleSettings(fs);
+
+    for (size_t depth : { 1000, 2000, 5000, 10000 }) {
+        std::wstring text = Repeat(L"\\{", depth * 2) + L"x" + Repeat(L"\\}", depth * 2);
+        double parse = Best(repeat, [&] { ParseInputDoc(text, fs); });
+        double copy = Best(repeat, [&] {
+            std::vector<RunStyleState> stack{ fs.compiledSettings->root };
+            for (size_t i = 0; i < depth; i++) stack.push_back(stack.back());
+        });
+        printf("depth %6zu | parse %7.3f ms, %6.1f ns per scope | copying the state %7.3f ms\n", depth, parse * 1e3,
+            parse * 1e9 / depth, copy * 1e3);
+    }
+}
+
+// Finding the run that contains a point, with RunIndex against a binary search over the runs and
+// against a linear scan, which only gets a sample of the points since it is so much slower.
+static void ReportRunIndex(int repeat) {
+    std::mt19937 rng(1);
+    for (size_t count : { 100, 1000000 }) {
+        std::vector<RunStyle> runs(count);
+        uint32_t cp = 0;
+        for (RunStyle& run : runs) {
+            run.cpBegin = cp;
+            cp += 1 + rng() % 16;
+            run.cpEnd = cp;
+            run.style = 0;
+        }
+        std::vector<uint32_t> points(1000000);
+        for (uint32_t& point : points) point = rng() % cp;
+        const size_t sample = std::min<size_t>(points.size(), 1000);
+
+        ImageVector<RunStyle> documentRuns(runs);
+        RunIndex index;
+        double build = Best(repeat, [&] { index = RunIndex(documentRuns); });
+        size_t indexSum = 0, searchSum = 0, scanSum = 0;
+        double indexed = Best(repeat, [&] {
+            indexSum = 0;
+            for (uint32_t point : points) indexSum += index.Find(point);
+        });
+        double search = Best(repeat, [&] {
+            searchSum = 0;
+            for (uint32_t point : points) {
+                auto found = std::upper_bound(runs.begin(), runs.end(), point,
+                    [](uint32_t point, const RunStyle& run) { return point < run.cpBegin; });
+                searchSum += found - runs.begin() - 1;
+            }
+        });
+        double scan = Best(repeat, [&] {
+            scanSum = 0;
+            for (size_t i = 0; i < sample; i++) {
+                size_t run = 0;
+                while (runs[run].cpEnd <= points[i]) run++;
+                scanSum += run;
+            }
+        });
+        size_t sampleSum = 0;
+        for (size_t i = 0; i < sample; i++) sampleSum += index.Find(points[i]);
+        if (indexSum != searchSum || sampleSum != scanSum) fprintf(stderr, "%zu runs: the searches disagree\n", count);
+        printf("%9zu runs | build %7.3f ms | RunIndex %7.1f ns, upper_bound %7.1f ns, linear scan %10.1f ns per query\n",
+            count, build * 1e3, indexed * 1e9 / points.size(), search * 1e9 / points.size(), scan * 1e9 / sample);
+    }
+}
+
+// A style entry and style set as they were before entries were packed into 8 bytes and the sets
+// into one pool.
+struct LegacyStyleEntry {
+    RunStyleType type;
+    uint32_t tag;
+    double value;
+};
+using LegacyStyleSet = std::vector<LegacyStyleEntry>;
+
+// Memory of the runs, the run index and the style table per million runs, with a few shared style
+// sets and with a distinct set for each styled run, and the same style table in the legacy layout.
+// Also times a pass over all runs and their entries in both layouts.
+static void ReportStyleMemory(int repeat) {
+    const size_t groups = 500000; // two runs each
+    std::wstring shared, distinct;
+    for (size_t i = 0; i < groups; i++) {
+        shared += L"\\{\\f{ss" + std::to_wstring(10 + i % 10) + L"}w\\}x";
+        distinct += L"\\{\\f{kern}\\v{wght=" + std::to_wstring(i) + L"}w\\}x";
+    }
+    FontSelector fs;
+    for (const auto& corpus : { std::make_pair("10 shared sets", &shared), std::make_pair("a distinct set each", &distinct) }) {
+        ParsedDocument doc;
+        double parse = Best(repeat, [&] { doc = ParseInputDoc(*corpus.second, fs); });
+        const StyleTable& table = doc.styleTable;
+
+        std::vector<LegacyStyleSet> legacy(table.Size());
+        size_t entries = 0;
+        for (StyleId id = 0; id < table.Size(); id++) {
+            for (const RunStyleEntry& entry : table.Get(id)) legacy[id].push_back({ entry.Type(), entry.Tag(), entry.value });
+            entries += table.Get(id).size();
+        }
+        size_t runs = Footprint(doc.styles) + Footprint(doc.runIndex);
+        size_t tableBytes = Footprint(table);
+        // The hash index over the sets is the same in both layouts; only the entry storage differs.
+        size_t pool = entries * sizeof(RunStyleEntry) + (table.Size() + 1) * sizeof(uint32_t);
+        size_t legacyTableBytes = tableBytes - pool + Footprint(legacy);
+
+        double sum = 0, legacySum = 0;
+        double pass = Best(repeat, [&] {
+            sum = 0;
+            for (const RunStyle& run : doc.styles) {
+                for (const RunStyleEntry& entry : table.Get(run.style)) sum += entry.value;
+            }
+        });
+        double legacyPass = Best(repeat, [&] {
+            legacySum = 0;
+            for (const RunStyle& run : doc.styles) {
+                for (const LegacyStyleEntry& entry : legacy[run.style]) legacySum += entry.value;
+            }
+        });
+        if (sum != legacySum) fprintf(stderr, "%s: the passes disagree\n", corpus.first);
+
+        double perMillion = 1e6 / doc.styles.size() / 1e6; // MB per million runs
+        printf("%-20s | %7zu sets | parse %7.1f ms | runs + index %6.1f MB, style table %6.1f MB, legacy %6.1f MB"
+            " | pass %6.2f ms, legacy %6.2f ms\n", corpus.first, table.Size(), parse * 1e3, runs * perMillion,
+            tableBytes * perMillion, legacyTableBytes * perMillion, pass * 1e3, legacyPass * 1e3);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t size = 4000000;
+    int repeat = 5;
+    std::vector<Corpus> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else {
+            Corpus corpus;
+            if (!LoadCorpus(argv[i], corpus)) {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 1;
+            }
+            files.push_back(std::move(corpus));
+        }
+    }
+    std::vector<Corpus> corpora = SyntheticCorpora(size);
+    for (const Corpus& corpus : corpora) Report(corpus, repeat);
+    for (const Corpus& corpus : files) Report(corpus, repeat);
+
+    printf("\ntext building\n");
+    for (const Corpus& corpus : corpora) ReportBuilder(corpus, repeat);
+
+    printf("\nescape scan\n");
+    for (const Corpus& corpus : corpora) ReportScan(corpus, repeat);
+
+    printf("\nnested scopes\n");
+    ReportNesting(repeat);
+
+    printf("\nrun lookup\n");
+    ReportRunIndex(repeat);
+
+    printf("\nstyle memory per million runs\n");
+    ReportStyleMemory(repeat);
+    return 0;
+}
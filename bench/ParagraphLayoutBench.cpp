@@ -0,0 +1,115 @@
+// Scaling of paragraph layout on the worker pool, with a stub shaper standing in for
+// DirectWrite so that it runs anywhere. The stub spends a fixed amount of arithmetic on each
+// code unit, roughly what shaping costs, and its layouts record enough to check the merge.
+// Usage: ParagraphLayoutBench [--lines <n>] [--cost <rounds per code unit>] [--threads <most>] [--repeat <n>]
+#include "PortableCommon.h"
+#include "DocParser.h"
+#include "Paragraphs.h"
+#include "ParallelLayout.h"
+#include <chrono>
+#include <cstdio>
+
+struct StubLayout {
+    uint32_t cpBegin;
+    uint32_t length;
+    uint64_t glyphs; // a digest of the shaping work, equal for equal paragraphs
+};
+using StubHandle = std::shared_ptr<const StubLayout>;
+
+static StubHandle StubShape(const ParsedDocument& doc, const Paragraph& paragraph, int cost) {
+    uint64_t h = paragraph.hash;
+    for (uint32_t cp = paragraph.cpBegin; cp < paragraph.cpEnd; cp++) {
+        for (int k = 0; k < cost; k++) h = (h ^ doc.text[cp]) * 0x100000001B3ull + (h >> 29);
+    }
+    for (uint32_t i = paragraph.runBegin; i < paragraph.runEnd; i++) {
+        for (const RunStyleEntry& entry : doc.styleTable.Get(doc.styles[i].style)) h = (h ^ entry.key) * 0x100000001B3ull;
+    }
+    return std::make_shared<const StubLayout>(StubLayout{ paragraph.cpBegin, paragraph.cpEnd - paragraph.cpBegin, h });
+}
+
+// Lines of several scripts, with features and axis values on some of the words.
+static std::wstring MultiScriptProof(size_t lines) {
+    static const wchar_t* samples[] = {
+        L"The quick brown fox \\{\\f{smcp}jumps over\\} the lazy dog, \\v{wght=700}again and again.",
+        L"\x79C1\x306F\x30AC\x30E9\x30B9\x3092\x98DF\x3079\x3089\x308C\x307E\x3059\x3002\\{\\f{vert}\x300C\x3042\x300D\\}",
+        L"\x0627\x0644\x0633\x0644\x0627\x0645 \x0639\x0644\x064A\x0643\x0645 \\{\\f{ss01}\x0645\x0631\x062D\x0628\x0627\\} \x0628\x0627\x0644\x0639\x0627\x0644\x0645",
+        L"\x0928\x092E\x0938\x094D\x0924\x0947 \x0926\x0941\x0928\x093F\x092F\x093E \\{\\v{wdth=80}\x0939\x093F\x0928\x094D\x0926\x0940\\}",
+    };
+    std::wstring text;
+    for (size_t i = 0; i < lines; i++) {
+        text += std::to_wstring(i) + L" " + samples[i % 4] + L" " + samples[(i * 7 + 1) % 4];
+        if (i + 1 < lines) text += L"\n";
+    }
+    return text;
+}
+
+template<typename Fn>
+static double Best(int repeat, Fn fn) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    size_t lines = 5000;
+    int cost = 64;
+    int repeat = 5;
+    size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--lines" && i + 1 < argc) {
+            lines = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--cost" && i + 1 < argc) {
+            cost = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            maxThreads = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else {
+            fprintf(stderr, "unknown argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    FontSelector fs;
+    fs.parseEscapes = true;
+    fs.userFeaturesEnabled = true;
+    fs.userVariationEnabled = true;
+    fs.compiledSettings = CompileStyleSettings(fs);
+    ParsedDocument doc = ParseInputDoc(MultiScriptProof(lines), fs);
+    std::vector<Paragraph> paragraphs = SplitParagraphs(doc);
+    auto prepare = [](const Paragraph&) {};
+    auto shape = [&](const Paragraph& paragraph) { return StubShape(doc, paragraph, cost); };
+
+    // The serial result every pool size must reproduce, in document order.
+    std::vector<uint64_t> expected;
+    for (const Paragraph& paragraph : paragraphs) expected.push_back(shape(paragraph)->glyphs);
+
+    printf("%zu paragraphs, %zu code units, %d rounds per code unit, %u hardware threads\n",
+        paragraphs.size(), doc.text.size(), cost, std::thread::hardware_concurrency());
+    double serial = 0;
+    for (size_t threads = 1; ; threads = std::min(threads * 2, maxThreads)) {
+        ThreadPool pool(threads);
+        ParagraphLayoutStats stats;
+        std::vector<StubHandle> layouts;
+        double full = Best(repeat, [&] {
+            std::unordered_map<uint64_t, StubHandle> cache; // a font switch starts from nothing
+            layouts = LayOutParagraphs(paragraphs, cache, pool, prepare, shape, &stats);
+        });
+        for (size_t i = 0; i < paragraphs.size(); i++) {
+            if (layouts[i]->glyphs != expected[i] || layouts[i]->length != paragraphs[i].cpEnd - paragraphs[i].cpBegin) {
+                fprintf(stderr, "paragraph %zu differs from the serial layout\n", i);
+                return 1;
+            }
+        }
+        if (threads == 1) serial = full;
+        printf("%3zu threads: %8.2f ms, %5.2fx, %3.0f%% efficiency (%zu laid out)\n",
+            threads, full * 1e3, serial / full, serial / full / threads * 100, stats.shaped);
+        if (threads == maxThreads) break;
+    }
+    return 0;
+}
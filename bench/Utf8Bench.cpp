@@ -0,0 +1,99 @@
+// Throughput of UTF-8 to UTF-16 transcoding, the scalar decoder against ToUtf16 with its vector
+// ASCII path, on synthetic corpora and on files.
+// Usage: Utf8Bench [--size <bytes per synthetic corpus>] [--repeat <n>] [file...]
+#include "PortableCommon.h"
+#include "Utf8.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+struct Corpus {
+    std::string name;
+    std::string bytes;
+};
+
+static std::string Repeat(const std::string& unit, size_t size) {
+    std::string bytes;
+    bytes.reserve(size + unit.size());
+    while (bytes.size() < size) bytes += unit;
+    return bytes;
+}
+
+// Random bytes, mostly ASCII, so that errors come at random points between ASCII runs.
+static std::string Malformed(size_t size) {
+    std::mt19937 rng(1);
+    std::string bytes(size, '\0');
+    for (char& b : bytes) b = static_cast<char>(rng() % 8 ? 'a' + rng() % 26 : rng() % 0x100);
+    return bytes;
+}
+
+static std::vector<Corpus> SyntheticCorpora(size_t size) {
+    return {
+        { "ascii", Repeat("The quick brown fox jumps over the lazy dog. ", size) },
+        { "latin", Repeat("Voix ambigu\xC3\xAB d'un c\xC5\x93ur qui, au z\xC3\xA9phyr, pr\xC3\xA9" "f\xC3\xA8re les jattes de kiwis. ", size) },
+        { "cyrillic", Repeat("\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 \xD0\xB5\xD1\x89\xD1\x91 \xD1\x8D\xD1\x82\xD0\xB8\xD1\x85 ", size) },
+        { "cjk", Repeat("\xE7\xA7\x81\xE3\x81\xAF\xE3\x82\xAC\xE3\x83\xA9\xE3\x82\xB9\xE3\x82\x92\xE9\xA3\x9F\xE3\x81\xB9\xE3\x82\x89\xE3\x82\x8C\xE3\x81\xBE\xE3\x81\x99\xE3\x80\x82", size) },
+        { "emoji", Repeat("\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB \xF0\x9F\x98\x80\xF0\x9F\x8E\x89 ", size) },
+        { "malformed", Malformed(size) },
+    };
+}
+
+static bool LoadCorpus(const char* path, Corpus& corpus) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    corpus.name = path;
+    corpus.bytes.assign((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Best time of repeat runs of fn, in seconds.
+template<typename Fn>
+static double Best(int repeat, Fn fn) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+static void Report(const Corpus& corpus, int repeat) {
+    std::u16string scalarOut(corpus.bytes.size(), u'\0'), vectorOut(corpus.bytes.size(), u'\0');
+    Utf8::DecodeResult scalarResult, vectorResult;
+    double scalar = Best(repeat, [&] { scalarResult = Utf8::ToUtf16Scalar(corpus.bytes.data(), corpus.bytes.size(), &scalarOut[0]); });
+    double vector = Best(repeat, [&] { vectorResult = Utf8::ToUtf16(corpus.bytes.data(), corpus.bytes.size(), &vectorOut[0]); });
+    // ToUtf16 stores whole vector blocks, so past what it wrote the buffers may differ.
+    if (scalarResult.written != vectorResult.written || scalarResult.errors != vectorResult.errors
+        || scalarOut.compare(0, scalarResult.written, vectorOut, 0, vectorResult.written) != 0)
+        fprintf(stderr, "%s: the decoders disagree\n", corpus.name.c_str());
+    double mb = corpus.bytes.size() / 1e6; // as UTF-8
+    printf("%-12s %8.2f MB %9zu units %8zu errors | scalar %7.1f MB/s, ToUtf16 %7.1f MB/s\n", corpus.name.c_str(), mb,
+        vectorResult.written, vectorResult.errors, mb / scalar, mb / vector);
+}
+
+int main(int argc, char** argv) {
+    size_t size = 16000000;
+    int repeat = 5;
+    std::vector<Corpus> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else {
+            Corpus corpus;
+            if (!LoadCorpus(argv[i], corpus)) {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 1;
+            }
+            files.push_back(std::move(corpus));
+        }
+    }
+    for (const Corpus& corpus : SyntheticCorpora(size)) Report(corpus, repeat);
+    for (const Corpus& corpus : files) Report(corpus, repeat);
+    return 0;
+}
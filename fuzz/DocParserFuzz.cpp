@@ -0,0 +1,221 @@
+// libFuzzer target for the document parser. The first byte of an input selects the settings,
+// the rest is the UTF-8 source. Each input is parsed and the result checked for invariants,
+// then the incremental, streaming and cached paths must reproduce it exactly.
+#include "PortableCommon.h"
+#include "DocParser.h"
+#include "DocCache.h"
+#include "Paragraphs.h"
+#include "Utf8.h"
+#include <cstdio>
+
+#define FUZZ_CHECK(condition)                                                                   \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);      \
+            abort();                                                                            \
+        }                                                                                       \
+    } while (0)
+
+enum FuzzFlags : uint8_t {
+    FuzzParseEscapes = 1,
+    FuzzUserFeatures = 2,
+    FuzzUserVariations = 4,
+    FuzzSegmentation = 8
+    // The upper four bits pick the chunk size of the streaming parse.
+};
+
+static std::wstring Widen(const uint8_t* data, size_t size) {
+    std::u16string utf16(size, u'\0');
+    utf16.resize(Utf8::ToUtf16(reinterpret_cast<const char*>(data), size, &utf16[0]).written);
+    return std::wstring(utf16.begin(), utf16.end());
+}
+
+// Runs and their style sets, compared by content since equal sets may have different ids.
+struct FlatRun {
+    uint32_t cpBegin;
+    uint32_t cpEnd;
+    std::vector<RunStyleEntry> style;
+    bool operator==(const FlatRun& other) const {
+        return cpBegin == other.cpBegin && cpEnd == other.cpEnd && style == other.style;
+    }
+};
+
+static std::vector<FlatRun> Flatten(const ParsedDocument& doc) {
+    std::vector<FlatRun> runs;
+    for (const RunStyle& run : doc.styles) {
+        StyleSpan style = doc.styleTable.Get(run.style);
+        runs.push_back(FlatRun{ run.cpBegin, run.cpEnd, std::vector<RunStyleEntry>(style.begin(), style.end()) });
+    }
+    return runs;
+}
+
+static std::vector<uint64_t> ParagraphHashes(const ParsedDocument& doc) {
+    std::vector<uint64_t> hashes;
+    for (const Paragraph& paragraph : SplitParagraphs(doc)) hashes.push_back(paragraph.hash);
+    return hashes;
+}
+
+static void CheckSame(const ParsedDocument& a, const ParsedDocument& b) {
+    FUZZ_CHECK(a.text == b.text);
+    FUZZ_CHECK(Flatten(a) == Flatten(b));
+    FUZZ_CHECK(a.unknownTags == b.unknownTags);
+    FUZZ_CHECK(ParagraphHashes(a) == ParagraphHashes(b));
+}
+
+static bool IsParagraphSeparator(wchar_t ch) {
+    return ch == L'\n' || ch == L'\r' || ch == 0x85 || ch == 0x2029;
+}
+
+static void CheckParagraphs(const ParsedDocument& doc) {
+    std::vector<Paragraph> paragraphs = SplitParagraphs(doc);
+    FUZZ_CHECK(!paragraphs.empty());
+    FUZZ_CHECK(paragraphs.front().cpBegin == 0 && paragraphs.back().cpEnd == doc.text.size());
+    for (size_t i = 0; i < paragraphs.size(); i++) {
+        const Paragraph& paragraph = paragraphs[i];
+        FUZZ_CHECK(paragraph.cpBegin <= paragraph.cpEnd);
+        for (uint32_t cp = paragraph.cpBegin; cp < paragraph.cpEnd; cp++) FUZZ_CHECK(!IsParagraphSeparator(doc.text[cp]));
+        if (i > 0) {
+            // One separator between paragraphs, where CRLF counts as one.
+            std::wstring_view gap = std::wstring_view(doc.text).substr(paragraphs[i - 1].cpEnd, paragraph.cpBegin - paragraphs[i - 1].cpEnd);
+            FUZZ_CHECK((gap.size() == 1 && IsParagraphSeparator(gap[0])) || gap == L"\r\n");
+        }
+        // Exactly the runs overlapping the paragraph, which are none for an empty one.
+        FUZZ_CHECK(paragraph.runBegin <= paragraph.runEnd && paragraph.runEnd <= doc.styles.size());
+        for (uint32_t j = 0; j < doc.styles.size(); j++) {
+            const RunStyle& run = doc.styles[j];
+            bool overlaps = std::max(run.cpBegin, paragraph.cpBegin) < std::min(run.cpEnd, paragraph.cpEnd);
+            FUZZ_CHECK(overlaps == (j >= paragraph.runBegin && j < paragraph.runEnd));
+        }
+    }
+}
+
+static void CheckDocument(const ParsedDocument& doc, bool segmented) {
+    const size_t length = doc.text.size();
+    // Runs are flat, so runs of the same depth not overlapping means no two runs overlap.
+    for (size_t i = 0; i < doc.styles.size(); i++) {
+        const RunStyle& run = doc.styles[i];
+        FUZZ_CHECK(run.cpBegin < run.cpEnd && run.cpEnd <= length);
+        FUZZ_CHECK(run.style < doc.styleTable.Size());
+        if (i > 0) {
+            const RunStyle& prev = doc.styles[i - 1];
+            FUZZ_CHECK(prev.cpEnd <= run.cpBegin);
+            FUZZ_CHECK(prev.cpEnd < run.cpBegin || prev.style != run.style);
+        }
+    }
+    for (StyleId id = 0; id < doc.styleTable.Size(); id++) {
+        StyleSpan style = doc.styleTable.Get(id);
+        for (size_t j = 1; j < style.size(); j++) FUZZ_CHECK(style.data()[j - 1].key < style.data()[j].key);
+    }
+
+    CheckParagraphs(doc);
+
+    FUZZ_CHECK(doc.runIndex.Size() == doc.styles.size());
+    for (size_t i = 0; i < doc.styles.size(); i++) {
+        const RunStyle& run = doc.styles[i];
+        FUZZ_CHECK(doc.runIndex.Find(run.cpBegin) == i);
+        FUZZ_CHECK(doc.runIndex.Find(run.cpEnd - 1) == i);
+        uint32_t gap = i + 1 < doc.styles.size() ? doc.styles[i + 1].cpBegin : uint32_t(length);
+        if (run.cpEnd < gap) FUZZ_CHECK(doc.runIndex.Find(run.cpEnd) == RunIndex::NO_RUN);
+    }
+
+    if (!segmented) return;
+    const TextSegmentation& seg = doc.segmentation;
+    FUZZ_CHECK(seg.graphemes.Size() == length && seg.words.Size() == length && seg.scripts.Size() == length);
+    if (length > 0) FUZZ_CHECK(seg.graphemes.Test(0) && seg.words.Test(0) && seg.scripts.Test(0));
+    for (size_t i = 0; i < length; i++) {
+        if (seg.scripts.Test(i)) FUZZ_CHECK(seg.graphemes.Test(i));
+    }
+}
+
+// Replaces a slice of the input, chosen from the input itself, with a style change, and parses
+// the result incrementally from previous, which was parsed from the input.
+static void CheckEdit(ParsedDocument previous, const std::wstring& input, const FontSelector& fs) {
+    size_t seed = std::hash<std::wstring>()(input);
+    size_t begin = input.empty() ? 0 : seed % (input.size() + 1);
+    size_t end = std::min(input.size(), begin + (seed >> 16) % 8);
+    const std::wstring insert = (seed >> 24) & 1 ? L"\\f{ss01}x" : L"}\\";
+    SharedText edited = std::make_shared<const std::wstring>(input.substr(0, begin) + insert + input.substr(end));
+
+    DocumentEdit edit{ uint32_t(begin), uint32_t(end), uint32_t(begin + insert.size()) };
+    ParsedDocument incremental = ParseInputDocIncremental(std::move(previous), edited, fs, edit);
+    ParsedDocument full = ParseInputDoc(*edited, fs);
+    CheckDocument(incremental, false);
+    CheckSame(incremental, full);
+}
+
+static void CheckIncremental(const ParsedDocument& doc, const std::wstring& input, const FontSelector& fs) {
+    ParsedDocument previous = ParseInputDoc(std::make_shared<const std::wstring>(input), fs);
+    CheckSame(previous, doc);
+    CheckEdit(std::move(previous), input, fs);
+}
+
+static void CheckStream(const ParsedDocument& doc, const std::wstring& input, const FontSelector& fs, size_t chunk) {
+    std::wstring text;
+    std::vector<FlatRun> runs;
+    DocumentSink sink;
+    sink.text = [&](const std::wstring_view& piece) { text.append(piece); };
+    sink.run = [&](const RunStyle& run, StyleSpan style) {
+        FUZZ_CHECK(run.cpEnd <= text.size());
+        runs.push_back(FlatRun{ run.cpBegin, run.cpEnd, std::vector<RunStyleEntry>(style.begin(), style.end()) });
+    };
+    DocumentStreamParser parser(fs, sink);
+    for (size_t pos = 0; pos < input.size(); pos += chunk)
+        parser.Feed(std::wstring_view(input).substr(pos, chunk));
+    parser.Finish();
+    FUZZ_CHECK(text == doc.text);
+    FUZZ_CHECK(runs == Flatten(doc));
+    FUZZ_CHECK(parser.UnknownTags() == doc.unknownTags);
+}
+
+static void CheckCache(const ParsedDocument& doc, const std::wstring& input, const FontSelector& fs) {
+    uint64_t key = DocCache::KeyOf(input, fs);
+    auto image = std::make_shared<const std::vector<uint8_t>>(DocCache::Write(doc, key));
+    CachedDocument cached;
+    FUZZ_CHECK(cached.Open(image->data(), image->size(), key));
+    FUZZ_CHECK(!CachedDocument().Open(image->data(), image->size(), key + 1));
+    FUZZ_CHECK(cached.Verify());
+    ParsedDocument loaded;
+    cached.Load(loaded, image);
+    CheckDocument(loaded, false);
+    CheckSame(loaded, doc);
+    // Editing the loaded document copies what changes out of the image, which stays as it was.
+    std::vector<uint8_t> unchanged = *image;
+    CheckEdit(loaded, input, fs);
+    FUZZ_CHECK(*image == unchanged);
+
+    // A checkpoint that would restore a run that does not exist, or start past the text, fails
+    // verification.
+    if (doc.checkpoints.empty()) return;
+    const DocCache::CacheHeader& header = *reinterpret_cast<const DocCache::CacheHeader*>(image->data());
+    auto corrupt = [&](auto change) {
+        auto copy = std::make_shared<std::vector<uint8_t>>(*image);
+        change(*reinterpret_cast<ParseCheckpoint*>(copy->data() + header.checkpointOffset));
+        CachedDocument corrupted;
+        FUZZ_CHECK(corrupted.Open(copy->data(), copy->size(), key));
+        FUZZ_CHECK(!corrupted.Verify());
+    };
+    corrupt([](ParseCheckpoint& cp) { cp.runCount = 0; cp.lastRunStyle = 0; });
+    corrupt([&](ParseCheckpoint& cp) { cp.cpRunBegin = header.textLength + 1; });
+    corrupt([&](ParseCheckpoint& cp) { cp.style = header.styleCount; });
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (size == 0) return 0;
+    uint8_t flags = data[0];
+    std::wstring input = Widen(data + 1, size - 1);
+
+    FontSelector fs;
+    fs.parseEscapes = (flags & FuzzParseEscapes) != 0;
+    fs.userFeaturesEnabled = (flags & FuzzUserFeatures) != 0;
+    fs.userFeatureSettings = L"liga=0, ss01, xxxx=2";
+    fs.userVariationEnabled = (flags & FuzzUserVariations) != 0;
+    fs.userVariationSettings = L"wght=650, opsz=12.5";
+    bool segmented = (flags & FuzzSegmentation) != 0;
+
+    ParsedDocument doc = ParseInputDoc(input, fs, segmented ? ParseSegmentation : ParseDefault);
+    CheckDocument(doc, segmented);
+    CheckIncremental(doc, input, fs);
+    CheckStream(doc, input, fs, size_t(1) << (flags >> 4 & 7));
+    CheckCache(doc, input, fs);
+    return 0;
+}
@@ -0,0 +1,36 @@
+// Stands in for libFuzzer where it is not available: runs the fuzz target once on each file
+// named on the command line, or on each file in a named directory, such as the seed corpus.
+#include "PortableCommon.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static void RunFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    LLVMFuzzerTestOneInput(data.data(), data.size());
+}
+
+int main(int argc, char** argv) {
+    size_t inputs = 0;
+    for (int i = 1; i < argc; i++) {
+        std::filesystem::path path(argv[i]);
+        if (std::filesystem::is_directory(path)) {
+            std::vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::directory_iterator(path)) {
+                if (entry.is_regular_file()) files.push_back(entry.path());
+            }
+            std::sort(files.begin(), files.end());
+            for (const auto& file : files) RunFile(file);
+            inputs += files.size();
+        } else {
+            RunFile(path);
+            inputs++;
+        }
+    }
+    printf("%zu inputs passed\n", inputs);
+    return inputs > 0 ? 0 : 1;
+}
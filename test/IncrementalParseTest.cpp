@@ -0,0 +1,143 @@
+// Checks ParseInputDocIncremental against ParseInputDoc on chains of random edits to documents
+// several checkpoint intervals long, so that the re-parse resumes from a checkpoint and splices
+// the rest of the previous document back in. Usage: IncrementalParseTest [seed] [edits per document]
+#include "PortableCommon.h"
+#include "DocParser.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <random>
+
+// Pieces of source that leave the parse at the scope it was in.
+static const wchar_t* const TOKENS[] = {
+    L"word ", L"the quick brown fox ", L"\x79C1\x306F\x30AC\x30E9\x30B9", L"\xD83D\xDC69\x200D\xD83D\xDCBB", L"a\x0301",
+    L"\n", L"\r\n", L"\x2029", L"\t", L"\\u0041", L"\\u{1F469}", L"\\x41", L"\\t", L"\\\\",
+};
+// Escapes that open or close a scope, style the current one, or are cut short, which only make
+// sense next to other pieces. An unbalanced scope means no checkpoints until it is closed.
+static const wchar_t* const FRAGMENTS[] = {
+    L"\\{", L"\\}", L"\\f{liga=0}", L"\\f{ss01, kern}", L"\\v{wght=700}", L"\\v{wdth=80.5, opsz=12}", L"\\f{zzzz}",
+    L"\\", L"{", L"}", L"\\f{", L"=3", L", ", L"ss02",
+};
+
+// A balanced group, so that the parse keeps coming back to the top level where checkpoints are.
+static std::wstring Group(std::mt19937& rng) {
+    static const wchar_t* const STYLES[] = { L"\\f{smcp}", L"\\f{onum, liga=0}", L"\\v{wght=300}", L"\\v{wght=900, wdth=75}", L"" };
+    std::wstring group = L"\\{";
+    group += STYLES[rng() % 5];
+    group += L"styled text";
+    if (rng() % 4 == 0) group += L"\\{\\f{ss03}inner\\}";
+    group += L"\\} ";
+    return group;
+}
+
+template<size_t N>
+static const wchar_t* Pick(std::mt19937& rng, const wchar_t* const (&tokens)[N]) {
+    return tokens[rng() % N];
+}
+
+static std::wstring Tokens(std::mt19937& rng, size_t count, bool fragments) {
+    std::wstring text;
+    for (size_t i = 0; i < count; i++) {
+        switch (rng() % 4) {
+        case 0: text += Group(rng); break;
+        case 1: text += fragments ? Pick(rng, FRAGMENTS) : Pick(rng, TOKENS); break;
+        default: text += Pick(rng, TOKENS); break;
+        }
+    }
+    return text;
+}
+
+static std::wstring Document(std::mt19937& rng, size_t size) {
+    std::wstring text;
+    while (text.size() < size) {
+        if (rng() % 2) text += Group(rng);
+        else text += L"plain text between the groups, with no escapes at all.\n";
+    }
+    return text;
+}
+
+// Replaces a random range, from empty to a few checkpoint intervals long, with random pieces.
+static DocumentEdit RandomEdit(std::mt19937& rng, const std::wstring& text, std::wstring& edited) {
+    uint32_t begin = static_cast<uint32_t>(rng() % (text.size() + 1));
+    uint32_t removed = 0;
+    switch (rng() % 4) {
+    case 0: break;
+    case 1: removed = rng() % 16; break;
+    case 2: removed = rng() % 512; break;
+    case 3: removed = rng() % 12000; break;
+    }
+    uint32_t end = std::min(static_cast<uint32_t>(text.size()), begin + removed);
+    std::wstring insert = Tokens(rng, rng() % 3 == 0 ? 0 : rng() % 12, rng() % 4 == 0);
+    edited = text.substr(0, begin) + insert + text.substr(end);
+    return DocumentEdit{ begin, end, static_cast<uint32_t>(begin + insert.size()) };
+}
+
+static bool SameRuns(const ParsedDocument& a, const ParsedDocument& b) {
+    if (a.styles.size() != b.styles.size()) return false;
+    for (size_t i = 0; i < a.styles.size(); i++) {
+        const RunStyle& x = a.styles[i];
+        const RunStyle& y = b.styles[i];
+        if (x.cpBegin != y.cpBegin || x.cpEnd != y.cpEnd) return false;
+        if (!(a.styleTable.Get(x.style) == b.styleTable.Get(y.style))) return false;
+    }
+    return true;
+}
+
+static bool IndexMatches(const ParsedDocument& doc) {
+    if (doc.runIndex.Size() != doc.styles.size()) return false;
+    for (size_t i = 0; i < doc.styles.size(); i++) {
+        if (doc.runIndex.Find(doc.styles[i].cpBegin) != i || doc.runIndex.Find(doc.styles[i].cpEnd - 1) != i) return false;
+    }
+    return true;
+}
+
+// Applies edits one after another, each to the incremental result of the one before.
+static void RunChain(std::mt19937& rng, const FontSelector& fs, size_t size, int edits, size_t& checkpoints) {
+    SharedText text = std::make_shared<const std::wstring>(Document(rng, size));
+    ParsedDocument doc = ParseInputDoc(text, fs);
+    for (int i = 0; i < edits; i++) {
+        checkpoints += doc.checkpoints.size();
+        std::wstring editedText;
+        DocumentEdit edit = RandomEdit(rng, *text, editedText);
+        text = std::make_shared<const std::wstring>(std::move(editedText));
+
+        doc = ParseInputDocIncremental(std::move(doc), text, fs, edit);
+        ParsedDocument full = ParseInputDoc(*text, fs);
+        bool same = doc.text == full.text && SameRuns(doc, full) && doc.unknownTags == full.unknownTags
+            && doc.coalescedRuns == full.coalescedRuns && IndexMatches(doc);
+        TEST_CHECK(same);
+        if (!same) {
+            printf("  document of %zu, edit %d replaced [%u, %u) by %u code units\n", text->size(), i,
+                edit.srcBegin, edit.srcOldEnd, edit.srcNewEnd - edit.srcBegin);
+            // Later edits would start from a wrong document and only repeat the failure.
+            return;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t seed = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 1;
+    int edits = argc > 2 ? atoi(argv[2]) : 40;
+    std::mt19937 rng(seed);
+
+    FontSelector plain;
+    FontSelector styled;
+    styled.userFeaturesEnabled = true;
+    styled.userFeatureSettings = L"liga=0, ss01";
+    styled.userVariationEnabled = true;
+    styled.userVariationSettings = L"wght=650";
+    styled.compiledSettings = CompileStyleSettings(styled);
+
+    size_t chains = 0, checkpoints = 0;
+    for (size_t intervals : { 3, 8, 24 }) {
+        for (const FontSelector* fs : { &plain, &styled }) {
+            RunChain(rng, *fs, intervals * 4096, edits, checkpoints);
+            chains++;
+        }
+    }
+    // Without several checkpoints per document the splice path would not run at all.
+    TEST_CHECK(checkpoints >= chains * edits * 2);
+    printf("%zu chains of %d edits, %.1f checkpoints per document, %d failures\n", chains, edits,
+        double(checkpoints) / (chains * edits), g_failures);
+    return g_failures != 0;
+}
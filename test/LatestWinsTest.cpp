@@ -0,0 +1,201 @@
+// Checks LatestWinsScheduler and LatestWinsPipeline with fake stages that stand in for layout and
+// drawing: only the newest snapshot has to come out, frames come out in order, running stages see
+// cancellation promptly, and every job is accounted for. Usage: LatestWinsTest
+#include "PortableCommon.h"
+#include "LatestWins.h"
+#include "TestCheck.h"
+#include <chrono>
+#include <cstdio>
+
+using Clock = std::chrono::steady_clock;
+
+struct FakeSnapshot {
+    int value;
+    int work; // steps of the slow stage, each about 100 us
+};
+
+struct FakeFrame {
+    int value = -1;
+    std::vector<int> stages;
+};
+
+struct Delivered {
+    int value;
+    uint64_t sequence;
+};
+
+// Collects what the pipeline delivers, from its thread.
+class Sink {
+public:
+    void Add(FakeFrame&& frame, uint64_t sequence) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_frames.push_back(Delivered{ frame.value, sequence });
+    }
+    std::vector<Delivered> Frames() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_frames;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<Delivered> m_frames;
+};
+
+// Busy for the given number of steps, or until cancelled.
+static bool Work(int steps, const CancelToken& token) {
+    for (int i = 0; i < steps; i++) {
+        if (token.IsCancelled()) return false;
+        auto until = Clock::now() + std::chrono::microseconds(100);
+        while (Clock::now() < until) {}
+    }
+    return true;
+}
+
+using FakePipeline = LatestWinsPipeline<FakeSnapshot, FakeFrame>;
+
+static std::vector<FakePipeline::Stage> FakeStages() {
+    return {
+        [](const FakeSnapshot& snapshot, FakeFrame& frame, const CancelToken& token) {
+            frame.stages.push_back(0);
+            return Work(snapshot.work, token);
+        },
+        [](const FakeSnapshot& snapshot, FakeFrame& frame, const CancelToken&) {
+            frame.stages.push_back(1);
+            frame.value = snapshot.value;
+            return true;
+        },
+    };
+}
+
+static void CheckAccounted(const LatestWinsScheduler::Stats& stats) {
+    TEST_CHECK(stats.submitted == stats.completed + stats.cancelled + stats.superseded + stats.failed);
+}
+
+// A burst of snapshots, as from typing, ends with the frame of the last one; frames that do come
+// out on the way are in submission order.
+static void TestBurst() {
+    Sink sink;
+    FakePipeline pipeline(FakeStages(), [&](FakeFrame&& frame, uint64_t sequence) { sink.Add(std::move(frame), sequence); });
+    const int count = 200;
+    uint64_t last = 0;
+    for (int i = 0; i < count; i++) {
+        uint64_t sequence = pipeline.Submit(FakeSnapshot{ i, 20 });
+        TEST_CHECK(sequence > last);
+        last = sequence;
+        if (i % 10 == 0) std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    pipeline.WaitIdle();
+
+    std::vector<Delivered> frames = sink.Frames();
+    TEST_CHECK(!frames.empty());
+    if (frames.empty()) return;
+    TEST_CHECK(frames.back().value == count - 1 && frames.back().sequence == last);
+    TEST_CHECK(pipeline.IsLatest(last));
+    for (size_t i = 1; i < frames.size(); i++) {
+        TEST_CHECK(frames[i - 1].sequence < frames[i].sequence);
+        TEST_CHECK(frames[i - 1].value < frames[i].value);
+    }
+    LatestWinsScheduler::Stats stats = pipeline.GetStats();
+    CheckAccounted(stats);
+    TEST_CHECK(stats.submitted == count && stats.completed == frames.size() && stats.failed == 0);
+    printf("burst: %d snapshots, %zu frames, %llu cancelled, %llu superseded\n", count, frames.size(),
+        (unsigned long long)stats.cancelled, (unsigned long long)stats.superseded);
+}
+
+// A stage that runs until cancelled stops soon after a newer snapshot comes in.
+static void TestPromptCancel() {
+    Sink sink;
+    std::atomic<bool> started{ false };
+    std::atomic<int64_t> stoppedAt{ 0 };
+    std::vector<FakePipeline::Stage> stages = {
+        [&](const FakeSnapshot& snapshot, FakeFrame& frame, const CancelToken& token) {
+            frame.value = snapshot.value;
+            if (snapshot.value != 0) return true;
+            started = true;
+            auto giveUp = Clock::now() + std::chrono::seconds(10);
+            while (!token.IsCancelled() && Clock::now() < giveUp) {}
+            stoppedAt = Clock::now().time_since_epoch().count();
+            return false;
+        },
+    };
+    FakePipeline pipeline(std::move(stages), [&](FakeFrame&& frame, uint64_t sequence) { sink.Add(std::move(frame), sequence); });
+    pipeline.Submit(FakeSnapshot{ 0, 0 });
+    while (!started) std::this_thread::yield();
+    auto submitted = Clock::now();
+    pipeline.Submit(FakeSnapshot{ 1, 0 });
+    pipeline.WaitIdle();
+
+    double latency = std::chrono::duration<double>(Clock::duration(stoppedAt.load()) - submitted.time_since_epoch()).count();
+    TEST_CHECK(latency < 1.0);
+    std::vector<Delivered> frames = sink.Frames();
+    TEST_CHECK(frames.size() == 1 && frames[0].value == 1);
+    LatestWinsScheduler::Stats stats = pipeline.GetStats();
+    CheckAccounted(stats);
+    TEST_CHECK(stats.cancelled == 1 && stats.completed == 1);
+    printf("cancel: stopped %.3f ms after the newer snapshot\n", latency * 1e3);
+}
+
+// A stage that gives up skips the rest of the stages and delivers nothing; one that throws is
+// counted, and the pipeline goes on with the next snapshot.
+static void TestStopAndFailure() {
+    Sink sink;
+    std::atomic<int> laterStages{ 0 };
+    std::vector<FakePipeline::Stage> stages = {
+        [](const FakeSnapshot& snapshot, FakeFrame& frame, const CancelToken&) {
+            if (snapshot.value == 1) throw std::runtime_error("fake failure");
+            frame.value = snapshot.value;
+            return snapshot.value != 0;
+        },
+        [&](const FakeSnapshot&, FakeFrame&, const CancelToken&) {
+            laterStages++;
+            return true;
+        },
+    };
+    FakePipeline pipeline(std::move(stages), [&](FakeFrame&& frame, uint64_t sequence) { sink.Add(std::move(frame), sequence); });
+    for (int value = 0; value < 3; value++) {
+        pipeline.Submit(FakeSnapshot{ value, 0 });
+        pipeline.WaitIdle();
+    }
+    std::vector<Delivered> frames = sink.Frames();
+    TEST_CHECK(frames.size() == 1 && frames[0].value == 2);
+    TEST_CHECK(laterStages == 1);
+    LatestWinsScheduler::Stats stats = pipeline.GetStats();
+    CheckAccounted(stats);
+    TEST_CHECK(stats.cancelled == 1 && stats.failed == 1 && stats.completed == 1);
+}
+
+// Destroying the pipeline cancels the running job and drops the waiting one.
+static void TestShutdown() {
+    Sink sink;
+    std::atomic<bool> started{ false };
+    auto begin = Clock::now();
+    {
+        std::vector<FakePipeline::Stage> stages = {
+            [&](const FakeSnapshot& snapshot, FakeFrame& frame, const CancelToken& token) {
+                started = true;
+                frame.value = snapshot.value;
+                return Work(100000, token);
+            },
+        };
+        FakePipeline pipeline(std::move(stages), [&](FakeFrame&& frame, uint64_t sequence) { sink.Add(std::move(frame), sequence); });
+        pipeline.Submit(FakeSnapshot{ 0, 0 });
+        while (!started) std::this_thread::yield();
+        pipeline.Submit(FakeSnapshot{ 1, 0 });
+        pipeline.Submit(FakeSnapshot{ 2, 0 });
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    TEST_CHECK(elapsed < 1.0);
+    TEST_CHECK(sink.Frames().empty());
+
+    // An idle one goes away at once too.
+    { LatestWinsScheduler idle; }
+}
+
+int main() {
+    TestBurst();
+    TestPromptCancel();
+    TestStopAndFailure();
+    TestShutdown();
+    printf("%d failures\n", g_failures);
+    return g_failures != 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdio>
+
+// Failed checks of the test, which main returns as g_failures != 0.
+inline int g_failures = 0;
+
+// Reports a failed condition with its place in the source and counts it, but goes on, so that
+// one run shows every failure.
+#define TEST_CHECK(condition)                                                                   \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);               \
+            g_failures++;                                                                       \
+        }                                                                                       \
+    } while (0)
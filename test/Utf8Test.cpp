@@ -0,0 +1,194 @@
+// Checks Utf8::ToUtf16 and ToUtf16Scalar against each other and against a reference decoder that
+// follows the WHATWG algorithm, which replaces maximal subparts as the Unicode standard recommends.
+// Each case runs at every offset within a vector block and with random neighbours, so that the
+// ASCII fast path, the tail and the sequence decoders all see it. Usage: Utf8Test [seed]
+#include "PortableCommon.h"
+#include "Utf8.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <iterator>
+#include <random>
+
+struct Decoded {
+    std::u16string text;
+    size_t errors = 0;
+    size_t firstError = SIZE_MAX;
+};
+
+static bool operator==(const Decoded& a, const Decoded& b) {
+    return a.text == b.text && a.errors == b.errors && a.firstError == b.firstError;
+}
+
+// A byte at a time, with the bounds of the next byte narrowed after the lead byte. A byte that
+// does not fit ends the sequence as one error and is looked at again as the start of the next.
+static Decoded Reference(const std::string& bytes) {
+    Decoded result;
+    uint32_t cp = 0, needed = 0, seen = 0;
+    uint8_t lower = 0x80, upper = 0xBF;
+    size_t start = 0;
+    auto error = [&](size_t at) {
+        if (result.errors++ == 0) result.firstError = at;
+        result.text += u'\xFFFD';
+    };
+    auto emit = [&](uint32_t c) {
+        if (c >= 0x10000) {
+            result.text += static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10));
+            result.text += static_cast<char16_t>(0xDC00 + ((c - 0x10000) & 0x3FF));
+        } else {
+            result.text += static_cast<char16_t>(c);
+        }
+    };
+    for (size_t i = 0; i < bytes.size(); i++) {
+        uint8_t b = static_cast<uint8_t>(bytes[i]);
+        if (needed == 0) {
+            start = i;
+            if (b < 0x80) {
+                emit(b);
+            } else if (b >= 0xC2 && b <= 0xDF) {
+                needed = 1;
+                cp = b & 0x1F;
+            } else if (b >= 0xE0 && b <= 0xEF) {
+                if (b == 0xE0) lower = 0xA0;
+                if (b == 0xED) upper = 0x9F;
+                needed = 2;
+                cp = b & 0x0F;
+            } else if (b >= 0xF0 && b <= 0xF4) {
+                if (b == 0xF0) lower = 0x90;
+                if (b == 0xF4) upper = 0x8F;
+                needed = 3;
+                cp = b & 0x07;
+            } else {
+                error(i);
+            }
+            continue;
+        }
+        if (b < lower || b > upper) {
+            cp = needed = seen = 0;
+            lower = 0x80;
+            upper = 0xBF;
+            error(start);
+            i--;
+            continue;
+        }
+        lower = 0x80;
+        upper = 0xBF;
+        cp = (cp << 6) | (b & 0x3F);
+        if (++seen == needed) {
+            emit(cp);
+            cp = needed = seen = 0;
+        }
+    }
+    if (needed) error(start);
+    return result;
+}
+
+static Decoded Decode(Utf8::DecodeResult (*decode)(const char*, size_t, char16_t*), const std::string& bytes) {
+    // Guard units past the end catch writes beyond the n that the output may take.
+    std::u16string buffer(bytes.size() + 16, u'\x5A5A');
+    Utf8::DecodeResult result = decode(bytes.data(), bytes.size(), &buffer[0]);
+    Decoded decoded;
+    decoded.text = buffer.substr(0, result.written);
+    decoded.errors = result.errors;
+    decoded.firstError = result.firstError;
+    TEST_CHECK(result.written <= bytes.size());
+    TEST_CHECK(buffer.find_first_not_of(u'\x5A5A', bytes.size()) == std::u16string::npos);
+    return decoded;
+}
+
+// Compares all three decoders on the bytes; returns whether they agree.
+static bool Agree(const std::string& bytes) {
+    Decoded expected = Reference(bytes);
+    Decoded scalar = Decode(Utf8::ToUtf16Scalar, bytes);
+    Decoded vector = Decode(Utf8::ToUtf16, bytes);
+    bool same = scalar == expected && vector == expected;
+    TEST_CHECK(same);
+    if (!same) {
+        printf("  bytes:");
+        for (unsigned char b : bytes) printf(" %02X", b);
+        printf("\n");
+    }
+    return same;
+}
+
+// The example of table 3-8 of the Unicode standard, with its expected output written out.
+static void TestStandardExample() {
+    std::string bytes = "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64";
+    Decoded decoded = Decode(Utf8::ToUtf16, bytes);
+    TEST_CHECK(decoded.text == u"\x0061\xFFFD\xFFFD\xFFFD\x0062\xFFFD\x0063\xFFFD\xFFFD\x0064");
+    TEST_CHECK(decoded.errors == 6 && decoded.firstError == 1);
+    Agree(bytes);
+}
+
+// Ill-formed sequences of every kind, each with the expected number of replacement characters.
+static const struct {
+    const char* bytes;
+    size_t errors;
+} MALFORMED[] = {
+    // Truncated sequences.
+    { "\xC3", 1 }, { "\xE2\x82", 1 }, { "\xF0\x9F\x98", 1 }, { "\xE2", 1 }, { "\xF0\x9F", 1 },
+    { "\xC3" "a", 1 }, { "\xE2\x82" "a", 1 }, { "\xF0\x9F\x98" "a", 1 }, { "\xF0\x9F\x98\xF0\x9F\x98\x80", 1 },
+    // Stray continuation bytes.
+    { "\x80", 1 }, { "\xBF", 1 }, { "\x80\x80\x80", 3 }, { "\xA9\xC3\xA9", 1 },
+    // Overlong forms.
+    { "\xC0\x80", 2 }, { "\xC1\xBF", 2 }, { "\xE0\x80\x80", 3 }, { "\xE0\x9F\xBF", 3 },
+    { "\xF0\x80\x80\x80", 4 }, { "\xF0\x8F\xBF\xBF", 4 },
+    // Surrogates, alone and paired.
+    { "\xED\xA0\x80", 3 }, { "\xED\xBF\xBF", 3 }, { "\xED\xA0\xBD\xED\xB8\x80", 6 },
+    // Above U+10FFFF, and bytes that never occur.
+    { "\xF4\x90\x80\x80", 4 }, { "\xF5\x80\x80\x80", 4 }, { "\xF7\xBF\xBF\xBF", 4 }, { "\xF8\x88\x80\x80\x80", 5 },
+    { "\xFC\x84\x80\x80\x80\x80", 6 }, { "\xFE", 1 }, { "\xFF", 1 },
+};
+
+// The boundaries of the well-formed ranges, which must decode without errors.
+static const char* const WELL_FORMED[] = {
+    "\x7F", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBD", "\xEF\xBF\xBF",
+    "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF", "\xE7\xA7\x81\xE3\x81\xAF", "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB",
+};
+
+// Places the case at every offset of a 16 byte block, after ASCII and before ASCII or the end.
+static void CheckPlaced(const std::string& bytes) {
+    for (size_t before = 0; before <= 33; before++) {
+        std::string prefix(before, 'x');
+        Agree(prefix + bytes);
+        Agree(prefix + bytes + std::string(20, 'y'));
+    }
+}
+
+static void TestCases() {
+    for (const auto& c : MALFORMED) {
+        Decoded decoded = Decode(Utf8::ToUtf16, c.bytes);
+        TEST_CHECK(decoded.errors == c.errors && decoded.firstError == 0);
+        CheckPlaced(c.bytes);
+    }
+    for (const char* bytes : WELL_FORMED) {
+        TEST_CHECK(Decode(Utf8::ToUtf16, bytes).errors == 0);
+        CheckPlaced(bytes);
+    }
+}
+
+// Random mixes of ASCII runs, well-formed sequences, ill-formed ones and random bytes.
+static void TestRandom(std::mt19937& rng, int count) {
+    for (int i = 0; i < count; i++) {
+        std::string bytes;
+        size_t pieces = rng() % 40;
+        for (size_t k = 0; k < pieces; k++) {
+            switch (rng() % 5) {
+            case 0: bytes += std::string(rng() % 40, static_cast<char>('a' + rng() % 26)); break;
+            case 1: bytes += WELL_FORMED[rng() % std::size(WELL_FORMED)]; break;
+            case 2: bytes += MALFORMED[rng() % std::size(MALFORMED)].bytes; break;
+            case 3: bytes += static_cast<char>(0x80 + rng() % 0x80); break;
+            default: bytes += static_cast<char>(rng() % 0x100); break;
+            }
+        }
+        if (!Agree(bytes)) return;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::mt19937 rng(argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 1);
+    TestStandardExample();
+    TestCases();
+    TestRandom(rng, 20000);
+    printf("%d failures\n", g_failures);
+    return g_failures != 0;
+}
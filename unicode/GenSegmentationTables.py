@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Generates SegmentationTables.h from the Unicode Character Database.
+
+Usage: GenSegmentationTables.py <ucd directory> <output header>
+
+The directory holds GraphemeBreakProperty.txt, WordBreakProperty.txt, emoji-data.txt,
+DerivedCoreProperties.txt and Scripts.txt, flat as in the UCD's auxiliary and emoji folders.
+They must all come from the same version of the UCD, e.g.
+https://www.unicode.org/Public/16.0.0/ucd/. The conformance tests GraphemeBreakTest.txt and
+WordBreakTest.txt of the same auxiliary folder go into unicode/, where SegmentationTest reads
+them as they are.
+
+Each property is mapped through a three-stage table: the top bits of a code point select a
+row of block numbers, the middle bits a block of values within it. Identical rows and blocks
+are stored once, which keeps the tables small since most of the code space is uniform.
+"""
+
+import os
+import re
+import sys
+
+CODE_POINTS = 0x110000
+SHIFT1 = 9  # code points per row: 1 << SHIFT1
+SHIFT2 = 4  # code points per block: 1 << SHIFT2
+
+GRAPHEME_BREAK = ["Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator", "Prepend",
+                  "SpacingMark", "L", "V", "T", "LV", "LVT"]
+WORD_BREAK = ["Other", "CR", "LF", "Newline", "Extend", "ZWJ", "Regional_Indicator", "Format",
+              "Katakana", "Hebrew_Letter", "ALetter", "Single_Quote", "Double_Quote", "MidNumLet",
+              "MidLetter", "MidNum", "Numeric", "ExtendNumLet", "WSegSpace"]
+INDIC_CONJUNCT_BREAK = ["None", "Consonant", "Extend", "Linker"]
+# Scripts that do not start a run of their own come first.
+FIRST_SCRIPTS = ["Unknown", "Common", "Inherited"]
+
+
+def load(ucd, name, select=None):
+    """Reads a UCD property file into {code point: value}, optionally for one property only."""
+    values = {}
+    version = None
+    with open(os.path.join(ucd, name), encoding="utf-8") as f:
+        for line in f:
+            if version is None:
+                m = re.match(r"#\s*\S+-(\d+\.\d+\.\d+)\.txt", line)
+                if m:
+                    version = m.group(1)
+            fields = [field.strip() for field in line.split("#")[0].split(";")]
+            if len(fields) < 2:
+                continue
+            if select is not None:
+                if fields[1] != select:
+                    continue
+                value = fields[2] if len(fields) > 2 else True
+            else:
+                value = fields[1]
+            first, _, last = fields[0].partition("..")
+            for cp in range(int(first, 16), int(last or first, 16) + 1):
+                values[cp] = value
+    return values, version
+
+
+def index_of(names, value, what):
+    if value not in names:
+        sys.exit("unknown %s value %s" % (what, value))
+    return names.index(value)
+
+
+def stages(values):
+    """Splits a value per code point into the three stages, sharing identical blocks and rows."""
+    blocks, block_ids = {}, []
+    size = 1 << SHIFT2
+    for cp in range(0, CODE_POINTS, size):
+        block_ids.append(blocks.setdefault(tuple(values[cp:cp + size]), len(blocks)))
+    rows, row_ids = {}, []
+    size = 1 << (SHIFT1 - SHIFT2)
+    for i in range(0, len(block_ids), size):
+        row_ids.append(rows.setdefault(tuple(block_ids[i:i + size]), len(rows)))
+    return row_ids, [b for row in rows for b in row], [v for block in blocks for v in block]
+
+
+def element_type(values):
+    return "uint8_t" if max(values) < 0x100 else "uint16_t"
+
+
+def array(out, name, values, per_line=24):
+    out.append("\tconstexpr %s %s[] = {" % (element_type(values), name))
+    for i in range(0, len(values), per_line):
+        out.append("\t\t" + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    out.append("\t};")
+
+
+def main():
+    ucd, output = sys.argv[1], sys.argv[2]
+    grapheme, version = load(ucd, "GraphemeBreakProperty.txt")
+    word, word_version = load(ucd, "WordBreakProperty.txt")
+    pictographic, emoji_version = load(ucd, "emoji-data.txt", "Extended_Pictographic")
+    conjunct, core_version = load(ucd, "DerivedCoreProperties.txt", "InCB")
+    scripts, script_version = load(ucd, "Scripts.txt")
+    # Files whose header names no version, as emoji-data.txt of some releases, are taken as is.
+    versions = {v for v in (version, word_version, emoji_version, core_version, script_version) if v}
+    if len(versions) != 1:
+        sys.exit("the UCD files are from different or unknown versions: %s" % ", ".join(sorted(versions)))
+
+    # Break properties, packed as GraphemeBreak | WordBreak << 4 | ExtPict << 9 | InCB << 10,
+    # are few enough to be numbered, so the blocks hold one byte per code point.
+    props, prop_ids = [], {}
+    break_values = []
+    for cp in range(CODE_POINTS):
+        packed = (index_of(GRAPHEME_BREAK, grapheme.get(cp, "Other"), "Grapheme_Cluster_Break")
+                  | index_of(WORD_BREAK, word.get(cp, "Other"), "Word_Break") << 4
+                  | (cp in pictographic) << 9
+                  | index_of(INDIC_CONJUNCT_BREAK, conjunct.get(cp, "None"), "InCB") << 10)
+        if packed not in prop_ids:
+            prop_ids[packed] = len(props)
+            props.append(packed)
+        break_values.append(prop_ids[packed])
+
+    script_names = FIRST_SCRIPTS + sorted(set(scripts.values()) - set(FIRST_SCRIPTS))
+    script_values = [script_names.index(scripts.get(cp, "Unknown")) for cp in range(CODE_POINTS)]
+
+    out = [
+        "#pragma once",
+        "",
+        "// Generated by unicode/GenSegmentationTables.py from the Unicode %s Character Database." % versions.pop(),
+        "// Do not edit.",
+        "",
+        "namespace Segmentation {",
+    ]
+    for name, values in (("GraphemeBreak", GRAPHEME_BREAK), ("WordBreak", WORD_BREAK),
+                         ("IndicConjunctBreak", INDIC_CONJUNCT_BREAK)):
+        prefix = "".join(c for c in name if c.isupper())
+        out.append("\tenum %s : uint8_t {" % name)
+        out.extend("\t\t%s_%s," % (prefix, v) for v in values)
+        out.append("\t};")
+    out += [
+        "",
+        "\tconstexpr uint32_t TABLE_SHIFT1 = %d;" % SHIFT1,
+        "\tconstexpr uint32_t TABLE_SHIFT2 = %d;" % SHIFT2,
+        "",
+        "\t// GraphemeBreak | WordBreak << 4 | Extended_Pictographic << 9 | IndicConjunctBreak << 10",
+    ]
+    array(out, "BREAK_PROPS", props, 12)
+    for name, values in (("BREAK", break_values), ("SCRIPT", script_values)):
+        rows, blocks, leaves = stages(values)
+        array(out, name + "_STAGE1", rows)
+        array(out, name + "_STAGE2", blocks)
+        array(out, name + "_STAGE3", leaves)
+    out.append("\tconstexpr const char* SCRIPT_NAMES[] = {")
+    for i in range(0, len(script_names), 6):
+        out.append("\t\t" + " ".join('"%s",' % n for n in script_names[i:i + 6]))
+    out.append("\t};")
+    out.append("}")
+
+    with open(output, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
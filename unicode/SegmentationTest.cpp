@@ -0,0 +1,82 @@
+// Checks TextSegmenter against the Unicode conformance tests for grapheme cluster and word
+// boundaries, in the format of the UCD's auxiliary/GraphemeBreakTest.txt and WordBreakTest.txt.
+// Lone surrogates are fed as single code units; a case where a high surrogate code point is
+// followed by a low one is skipped, since in UTF-16 the two would be a single code point.
+// Usage: SegmentationTest <directory with GraphemeBreakTest.txt and WordBreakTest.txt>
+#include "PortableCommon.h"
+#include "Segmentation.h"
+#include <cstdio>
+#include <fstream>
+
+// Reads a test line such as "÷ 0020 × 0308 ÷ 0020 ÷" into UTF-16 and the expected boundaries.
+// representable is cleared if the line pairs up surrogate code points.
+static bool ParseCase(const std::string& line, std::wstring& text, std::vector<size_t>& expected, bool& representable) {
+    text.clear();
+    expected.clear();
+    representable = true;
+    uint32_t previous = 0;
+    std::istringstream fields(line.substr(0, line.find('#')));
+    std::string field;
+    bool boundary = false;
+    while (fields >> field) {
+        if (field == "\xC3\xB7") { // ÷
+            boundary = true;
+        } else if (field == "\xC3\x97") { // ×
+            boundary = false;
+        } else {
+            if (boundary) expected.push_back(text.size());
+            uint32_t cp = static_cast<uint32_t>(std::stoul(field, nullptr, 16));
+            if (previous >= 0xD800 && previous <= 0xDBFF && cp >= 0xDC00 && cp <= 0xDFFF) representable = false;
+            previous = cp;
+            if (cp >= 0x10000) {
+                text.push_back(static_cast<wchar_t>(0xD800 + ((cp - 0x10000) >> 10)));
+                text.push_back(static_cast<wchar_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+            } else {
+                text.push_back(static_cast<wchar_t>(cp));
+            }
+        }
+    }
+    return !text.empty();
+}
+
+static int RunTests(const std::string& path, BoundaryBitmap TextSegmentation::*bitmap) {
+    std::ifstream file(path);
+    if (!file) {
+        printf("cannot open %s\n", path.c_str());
+        return 1;
+    }
+    int cases = 0, failures = 0, skipped = 0;
+    std::string line;
+    std::wstring text;
+    std::vector<size_t> expected;
+    bool representable;
+    while (std::getline(file, line)) {
+        if (!ParseCase(line, text, expected, representable)) continue;
+        if (!representable) {
+            skipped++;
+            continue;
+        }
+        cases++;
+        // Feed one code unit at a time, which also splits the surrogate pairs.
+        TextSegmenter segmenter;
+        for (wchar_t wch : text) segmenter.Add(wch);
+        TextSegmentation result;
+        segmenter.Finish(result);
+        std::vector<size_t> actual;
+        for (size_t i = 0; i < text.size(); i = (result.*bitmap).Next(i)) {
+            if ((result.*bitmap).Test(i)) actual.push_back(i);
+        }
+        if (actual != expected) {
+            if (failures++ < 10) printf("FAIL %s\n", line.c_str());
+        }
+    }
+    printf("%s: %d cases, %d skipped, %d failures\n", path.c_str(), cases, skipped, failures);
+    return failures != 0 || cases == 0;
+}
+
+int main(int argc, char** argv) {
+    std::string dir = argc > 1 ? std::string(argv[1]) + "/" : std::string();
+    int failed = RunTests(dir + "GraphemeBreakTest.txt", &TextSegmentation::graphemes);
+    failed |= RunTests(dir + "WordBreakTest.txt", &TextSegmentation::words);
+    return failed;
+}